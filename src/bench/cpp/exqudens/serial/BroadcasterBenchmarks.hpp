@@ -0,0 +1,144 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/Broadcaster.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class BroadcasterBenchmarks {
+
+    public:
+
+      inline static const size_t PORT_COUNT = 64;
+
+      static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      }
+
+      static double getPercentile(std::vector<double>& values, const double& percentile) {
+        if (values.empty()) {
+          return 0;
+        }
+        size_t index = std::min(values.size() - 1, static_cast<size_t>(percentile * static_cast<double>(values.size())));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values.at(index);
+      }
+
+  };
+
+  // Start time skew is the spread of the times the devices (pty masters) first see the payload, stamped by one epoll thread.
+  // 'mode' 0 is a loop of 'writeFrom' calls, 1 is 'Broadcaster::broadcast'. Total time is the duration of the sending call.
+  static void BroadcasterBenchmarks_skew(benchmark::State& state) {
+    bool broadcast = state.range(0) != 0;
+    size_t size = static_cast<size_t>(state.range(1));
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    int epoll = epoll_create1(EPOLL_CLOEXEC);
+    for (size_t i = 0; i < BroadcasterBenchmarks::PORT_COUNT; i++) {
+      ptys.emplace_back(std::make_unique<PtyDevice>());
+      serials.emplace_back(std::make_shared<Serial>());
+      serials.back()->open(ptys.back()->getSlavePath(), 1000);
+      epoll_event event = {};
+      event.events = EPOLLIN;
+      event.data.u64 = i;
+      epoll_ctl(epoll, EPOLL_CTL_ADD, ptys.back()->getMasterHandle(), &event);
+    }
+
+    std::vector<std::atomic<int64_t>> arrivals(ptys.size());
+    std::vector<std::atomic<size_t>> received(ptys.size());
+    std::atomic<size_t> completed = 0;
+    std::atomic<bool> stop = false;
+    std::thread receiver([&] {
+      std::vector<std::byte> buffer(65536);
+      epoll_event events[BroadcasterBenchmarks::PORT_COUNT];
+      while (!stop.load()) {
+        int count = epoll_wait(epoll, events, static_cast<int>(BroadcasterBenchmarks::PORT_COUNT), 10);
+        int64_t time = BroadcasterBenchmarks::now();
+        for (int i = 0; i < count; i++) {
+          size_t index = static_cast<size_t>(events[i].data.u64);
+          ssize_t length = ::read(ptys.at(index)->getMasterHandle(), buffer.data(), buffer.size());
+          if (length <= 0) {
+            continue;
+          }
+          int64_t expected = 0;
+          arrivals.at(index).compare_exchange_strong(expected, time);
+          if (received.at(index).fetch_add(static_cast<size_t>(length)) + static_cast<size_t>(length) == size) {
+            completed.fetch_add(1);
+            completed.notify_one();
+          }
+        }
+      }
+    });
+
+    Broadcaster broadcaster;
+    std::vector<std::byte> payload(size, std::byte('x'));
+    std::vector<double> skews;
+    std::vector<double> totals;
+    for (auto _ : state) {
+      for (size_t i = 0; i < ptys.size(); i++) {
+        arrivals.at(i).store(0);
+        received.at(i).store(0);
+      }
+      completed.store(0);
+      int64_t start = BroadcasterBenchmarks::now();
+      if (broadcast) {
+        broadcaster.broadcast(serials, payload);
+      } else {
+        for (std::shared_ptr<Serial>& serial : serials) {
+          serial->writeFrom(payload);
+        }
+      }
+      totals.emplace_back(static_cast<double>(BroadcasterBenchmarks::now() - start) / 1000.0);
+      size_t value = completed.load();
+      while (value < ptys.size()) {
+        completed.wait(value);
+        value = completed.load();
+      }
+      int64_t first = arrivals.front().load();
+      int64_t last = first;
+      for (std::atomic<int64_t>& arrival : arrivals) {
+        first = std::min(first, arrival.load());
+        last = std::max(last, arrival.load());
+      }
+      skews.emplace_back(static_cast<double>(last - first) / 1000.0);
+    }
+
+    stop.store(true);
+    receiver.join();
+    ::close(epoll);
+    state.counters["ports"] = static_cast<double>(ptys.size());
+    state.counters["io_uring"] = broadcaster.isIoUringEnabled() ? 1 : 0;
+    state.counters["skew_p50_us"] = BroadcasterBenchmarks::getPercentile(skews, 0.50);
+    state.counters["skew_p99_us"] = BroadcasterBenchmarks::getPercentile(skews, 0.99);
+    state.counters["total_p50_us"] = BroadcasterBenchmarks::getPercentile(totals, 0.50);
+    state.counters["total_p99_us"] = BroadcasterBenchmarks::getPercentile(totals, 0.99);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ptys.size()));
+  }
+
+  BENCHMARK(BroadcasterBenchmarks_skew)
+      ->ArgNames({"mode", "size"})
+      ->ArgsProduct({{0, 1}, {16, 1024}})
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+}
+
+#endif
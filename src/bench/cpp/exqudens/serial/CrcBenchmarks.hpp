@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/Crc.hpp"
+
+namespace exqudens {
+
+  class CrcBenchmarks {
+
+    public:
+
+      static std::vector<std::byte> createBytes(const size_t& size) {
+        std::mt19937 random(23);
+        std::vector<std::byte> result(size);
+        for (std::byte& value : result) {
+          value = static_cast<std::byte>(random() % 256);
+        }
+        return result;
+      }
+
+      // Byte at a time table lookup, the baseline the library checksums are compared with.
+      static uint16_t crc16Loop(const std::vector<std::byte>& bytes) {
+        static const std::vector<uint16_t> table = [] {
+          std::vector<uint16_t> result(256);
+          for (uint32_t i = 0; i < 256; i++) {
+            uint16_t value = static_cast<uint16_t>(i << 8);
+            for (int bit = 0; bit < 8; bit++) {
+              value = static_cast<uint16_t>((value & 0x8000) != 0 ? (value << 1) ^ 0x1021 : value << 1);
+            }
+            result[i] = value;
+          }
+          return result;
+        }();
+        uint16_t result = 0xFFFF;
+        for (std::byte value : bytes) {
+          result = static_cast<uint16_t>((result << 8) ^ table[(result >> 8) ^ static_cast<uint8_t>(value)]);
+        }
+        return result;
+      }
+
+  };
+
+  static void CrcBenchmarks_crc16(benchmark::State& state) {
+    std::vector<std::byte> bytes = CrcBenchmarks::createBytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Crc::crc16(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+  }
+
+  static void CrcBenchmarks_crc16Loop(benchmark::State& state) {
+    std::vector<std::byte> bytes = CrcBenchmarks::createBytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(CrcBenchmarks::crc16Loop(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+  }
+
+  static void CrcBenchmarks_crc32c(benchmark::State& state) {
+    std::vector<std::byte> bytes = CrcBenchmarks::createBytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Crc::crc32c(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+  }
+
+  static void CrcBenchmarks_crc32cSoftware(benchmark::State& state) {
+    std::vector<std::byte> bytes = CrcBenchmarks::createBytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Crc::crc32cSoftware(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+  }
+
+  BENCHMARK(CrcBenchmarks_crc16)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(CrcBenchmarks_crc16Loop)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(CrcBenchmarks_crc32c)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(CrcBenchmarks_crc32cSoftware)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/Cobs.hpp"
+#include "exqudens/serial/Slip.hpp"
+
+namespace exqudens {
+
+  class FramingBenchmarks {
+
+    public:
+
+      static std::vector<std::byte> createPayload(const size_t& size) {
+        std::mt19937 random(17);
+        std::vector<std::byte> result(size);
+        for (std::byte& value : result) {
+          value = static_cast<std::byte>(random() % 256);
+        }
+        return result;
+      }
+
+      // Byte at a time reference codecs, the baseline the library codecs are compared with.
+
+      static size_t cobsEncodeLoop(const std::vector<std::byte>& input, std::byte* output) {
+        size_t size = 1;
+        size_t codeIndex = 0;
+        unsigned int code = 1;
+        for (std::byte value : input) {
+          if (value != std::byte(0)) {
+            output[size++] = value;
+            code++;
+          }
+          if (value == std::byte(0) || code == 0xFF) {
+            output[codeIndex] = static_cast<std::byte>(code);
+            code = 1;
+            codeIndex = size++;
+          }
+        }
+        output[codeIndex] = static_cast<std::byte>(code);
+        return size;
+      }
+
+      static size_t slipEncodeLoop(const std::vector<std::byte>& input, std::byte* output) {
+        size_t size = 0;
+        output[size++] = Slip::END;
+        for (std::byte value : input) {
+          if (value == Slip::END) {
+            output[size++] = Slip::ESC;
+            output[size++] = Slip::ESC_END;
+          } else if (value == Slip::ESC) {
+            output[size++] = Slip::ESC;
+            output[size++] = Slip::ESC_ESC;
+          } else {
+            output[size++] = value;
+          }
+        }
+        output[size++] = Slip::END;
+        return size;
+      }
+
+  };
+
+  static void FramingBenchmarks_cobsEncode(benchmark::State& state) {
+    std::vector<std::byte> payload = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    std::vector<std::byte> buffer(Cobs::getMaxEncodedSize(payload.size()));
+    for (auto _ : state) {
+      std::memcpy(buffer.data(), payload.data(), payload.size());
+      benchmark::DoNotOptimize(Cobs::encode(buffer, payload.size()));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+  }
+
+  static void FramingBenchmarks_cobsEncodeLoop(benchmark::State& state) {
+    std::vector<std::byte> payload = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    std::vector<std::byte> buffer(Cobs::getMaxEncodedSize(payload.size()));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(FramingBenchmarks::cobsEncodeLoop(payload, buffer.data()));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+  }
+
+  static void FramingBenchmarks_cobsDecode(benchmark::State& state) {
+    std::vector<std::byte> encoded = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    size_t payloadSize = encoded.size();
+    encoded.resize(Cobs::getMaxEncodedSize(payloadSize));
+    encoded.resize(Cobs::encode(encoded, payloadSize));
+    std::vector<std::byte> buffer(encoded.size());
+    for (auto _ : state) {
+      std::memcpy(buffer.data(), encoded.data(), encoded.size());
+      benchmark::DoNotOptimize(Cobs::decode(buffer));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payloadSize));
+  }
+
+  static void FramingBenchmarks_slipEncode(benchmark::State& state) {
+    std::vector<std::byte> payload = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    std::vector<std::byte> buffer(Slip::getMaxEncodedSize(payload.size()));
+    for (auto _ : state) {
+      std::memcpy(buffer.data(), payload.data(), payload.size());
+      benchmark::DoNotOptimize(Slip::encode(buffer, payload.size()));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+  }
+
+  static void FramingBenchmarks_slipEncodeLoop(benchmark::State& state) {
+    std::vector<std::byte> payload = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    std::vector<std::byte> buffer(Slip::getMaxEncodedSize(payload.size()));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(FramingBenchmarks::slipEncodeLoop(payload, buffer.data()));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+  }
+
+  static void FramingBenchmarks_slipDecode(benchmark::State& state) {
+    std::vector<std::byte> encoded = FramingBenchmarks::createPayload(static_cast<size_t>(state.range(0)));
+    size_t payloadSize = encoded.size();
+    encoded.resize(Slip::getMaxEncodedSize(payloadSize));
+    encoded.resize(Slip::encode(encoded, payloadSize));
+    std::vector<std::byte> frame(encoded.begin() + 1, encoded.end() - 1);
+    std::vector<std::byte> buffer(frame.size());
+    for (auto _ : state) {
+      std::memcpy(buffer.data(), frame.data(), frame.size());
+      benchmark::DoNotOptimize(Slip::decode(buffer));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payloadSize));
+  }
+
+  BENCHMARK(FramingBenchmarks_cobsEncode)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(FramingBenchmarks_cobsEncodeLoop)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(FramingBenchmarks_cobsDecode)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(FramingBenchmarks_slipEncode)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(FramingBenchmarks_slipEncodeLoop)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+  BENCHMARK(FramingBenchmarks_slipDecode)->ArgName("size")->RangeMultiplier(8)->Range(8, 65536);
+
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/IoUring.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class IoUringBenchmarks {
+
+    public:
+
+      inline static const size_t MESSAGE_SIZE = 16;
+
+      static void openPorts(
+          const size_t& size,
+          const bool& ioUring,
+          std::vector<std::unique_ptr<PtyDevice>>& ptys,
+          std::vector<std::shared_ptr<Serial>>& serials
+      ) {
+        for (size_t i = 0; i < size; i++) {
+          ptys.emplace_back(std::make_unique<PtyDevice>());
+          serials.emplace_back(std::make_shared<Serial>(true, ioUring));
+          serials.back()->open(ptys.back()->getSlavePath(), 100);
+        }
+      }
+
+  };
+
+  static void IoUringBenchmarks_blocking(benchmark::State& state) {
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    IoUringBenchmarks::openPorts(static_cast<size_t>(state.range(0)), state.range(1) != 0, ptys, serials);
+    std::vector<unsigned char> message(IoUringBenchmarks::MESSAGE_SIZE, 'x');
+    std::vector<std::byte> buffer(IoUringBenchmarks::MESSAGE_SIZE);
+
+    for (auto _ : state) {
+      for (std::unique_ptr<PtyDevice>& pty : ptys) {
+        pty->write(message);
+      }
+      for (std::shared_ptr<Serial>& serial : serials) {
+        if (serial->readInto(buffer) != buffer.size()) {
+          state.SkipWithError("short read");
+          return;
+        }
+      }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * serials.size()));
+  }
+
+  static void IoUringBenchmarks_batch(benchmark::State& state) {
+    if (!IoUring::isSupported()) {
+      state.SkipWithError("io_uring is not supported");
+      return;
+    }
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    IoUringBenchmarks::openPorts(static_cast<size_t>(state.range(0)), false, ptys, serials);
+    std::vector<unsigned char> message(IoUringBenchmarks::MESSAGE_SIZE, 'x');
+
+    std::vector<std::byte> memory(serials.size() * IoUringBenchmarks::MESSAGE_SIZE);
+    std::vector<std::span<std::byte>> buffers = {std::span<std::byte>(memory)};
+    std::vector<IoUring::Completion> completions(serials.size());
+    IoUring ring(static_cast<unsigned int>(serials.size()));
+    ring.registerBuffers(buffers);
+
+    for (auto _ : state) {
+      for (std::unique_ptr<PtyDevice>& pty : ptys) {
+        pty->write(message);
+      }
+      for (size_t i = 0; i < serials.size(); i++) {
+        std::span<std::byte> bytes = std::span<std::byte>(memory).subspan(i * IoUringBenchmarks::MESSAGE_SIZE, IoUringBenchmarks::MESSAGE_SIZE);
+        ring.prepareReadFixed(serials.at(i)->getNativeHandle(), bytes, 0, i);
+      }
+      ring.submit(static_cast<unsigned int>(serials.size()));
+      size_t size = 0;
+      while (size < completions.size()) {
+        size += ring.reap(std::span<IoUring::Completion>(completions).subspan(size));
+        if (size < completions.size()) {
+          ring.submit(1);
+        }
+      }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * serials.size()));
+  }
+
+  BENCHMARK(IoUringBenchmarks_blocking)
+      ->ArgNames({"ports", "io_uring"})
+      ->Args({1, 0})->Args({1, 1})->Args({64, 0})->Args({64, 1})
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+  BENCHMARK(IoUringBenchmarks_batch)
+      ->ArgName("ports")
+      ->Arg(1)->Arg(64)
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+}
+
+#endif
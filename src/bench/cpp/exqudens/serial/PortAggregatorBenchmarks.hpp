@@ -0,0 +1,157 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/PortAggregator.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class PortAggregatorBenchmarks {
+
+    public:
+
+      inline static const size_t CHUNK_SIZE = 256;
+      inline static const size_t BYTES_PER_ITERATION = 1024 * 1024;
+
+      struct Chunk {
+        size_t port = 0;
+        std::chrono::steady_clock::time_point time;
+        std::vector<std::byte> bytes;
+      };
+
+  };
+
+  // Every port streams as fast as it is drained, an iteration consumes 1 MiB of the merged stream.
+  // 'mode' 0 is the global lock baseline, a reader thread per port stamps its chunks and appends them to one mutex guarded queue,
+  // 1 is 'PortAggregator'. 'out_of_order' counts chunks handed over with a time older than the chunk before.
+  static void PortAggregatorBenchmarks_merge(benchmark::State& state) {
+    bool aggregate = state.range(0) != 0;
+    size_t portCount = static_cast<size_t>(state.range(1));
+    std::vector<unsigned char> pattern(251);
+    for (size_t i = 0; i < pattern.size(); i++) {
+      pattern.at(i) = static_cast<unsigned char>(i);
+    }
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    for (size_t i = 0; i < portCount; i++) {
+      ptys.emplace_back(std::make_unique<PtyDevice>());
+      serials.emplace_back(std::make_shared<Serial>());
+      serials.back()->open(ptys.back()->getSlavePath(), 10);
+    }
+
+    std::mutex mutex;
+    std::deque<PortAggregatorBenchmarks::Chunk> queue;
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> readers;
+    std::unique_ptr<PortAggregator> aggregator;
+    if (aggregate) {
+      aggregator = std::make_unique<PortAggregator>(serials, PortAggregatorBenchmarks::CHUNK_SIZE);
+    } else {
+      for (size_t i = 0; i < portCount; i++) {
+        readers.emplace_back([&, i] {
+          std::vector<std::byte> buffer(PortAggregatorBenchmarks::CHUNK_SIZE);
+          while (!stop.load(std::memory_order_relaxed)) {
+            std::error_code error;
+            size_t length = serials.at(i)->readInto(buffer, error);
+            if (length == 0) {
+              continue;
+            }
+            PortAggregatorBenchmarks::Chunk chunk;
+            chunk.port = i;
+            chunk.time = std::chrono::steady_clock::now();
+            chunk.bytes.assign(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(length));
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.emplace_back(std::move(chunk));
+          }
+        });
+      }
+    }
+    for (std::unique_ptr<PtyDevice>& pty : ptys) {
+      pty->startStream(pattern, 0);
+    }
+
+    size_t received = 0;
+    size_t chunks = 0;
+    size_t outOfOrder = 0;
+    std::chrono::steady_clock::time_point last;
+    std::vector<size_t> perPort(portCount);
+    auto consume = [&](size_t port, std::chrono::steady_clock::time_point time, std::span<const std::byte> bytes) {
+      if (time < last) {
+        outOfOrder++;
+      }
+      last = time;
+      perPort.at(port) += bytes.size();
+      received += bytes.size();
+      chunks++;
+    };
+    for (auto _ : state) {
+      size_t target = received + PortAggregatorBenchmarks::BYTES_PER_ITERATION;
+      while (received < target) {
+        if (aggregate) {
+          aggregator->wait([&](const PortAggregator::Chunk& chunk) {
+            consume(chunk.port, chunk.time, chunk.bytes);
+          }, std::chrono::milliseconds(100));
+          continue;
+        }
+        std::deque<PortAggregatorBenchmarks::Chunk> taken;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          taken.swap(queue);
+        }
+        if (taken.empty()) {
+          std::this_thread::yield();
+        }
+        for (PortAggregatorBenchmarks::Chunk& chunk : taken) {
+          consume(chunk.port, chunk.time, chunk.bytes);
+        }
+      }
+    }
+
+    if (aggregator) {
+      aggregator->stop();
+    }
+    stop.store(true);
+    for (std::thread& reader : readers) {
+      reader.join();
+    }
+    for (std::unique_ptr<PtyDevice>& pty : ptys) {
+      pty->stop();
+    }
+    for (std::shared_ptr<Serial>& serial : serials) {
+      serial->close();
+    }
+    size_t minimum = received;
+    for (size_t value : perPort) {
+      minimum = std::min(minimum, value);
+    }
+    state.counters["ports"] = static_cast<double>(portCount);
+    state.counters["chunk_avg_bytes"] = chunks == 0 ? 0 : static_cast<double>(received) / static_cast<double>(chunks);
+    state.counters["out_of_order"] = static_cast<double>(outOfOrder);
+    state.counters["min_port_share"] = received == 0 ? 0 : static_cast<double>(minimum * portCount) / static_cast<double>(received);
+    state.SetBytesProcessed(static_cast<int64_t>(received));
+  }
+
+  BENCHMARK(PortAggregatorBenchmarks_merge)
+      ->ArgNames({"mode", "ports"})
+      ->ArgsProduct({{0, 1}, {4, 16}})
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+
+}
+
+#endif
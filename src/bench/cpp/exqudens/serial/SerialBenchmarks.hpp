@@ -0,0 +1,262 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Journal.hpp"
+#include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/TransactionEngine.hpp"
+
+namespace exqudens {
+
+  class SerialBenchmarks {
+
+    public:
+
+      // 'timeoutInterByte' 0 disables the inter-byte timeout.
+      static std::shared_ptr<Serial> open(
+          const PtyDevice& pty,
+          const unsigned int& baudRate,
+          const unsigned int& timeoutInterByte,
+          const unsigned int& timeoutRead
+      ) {
+        std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+        serial->open(
+            pty.getSlavePath(),
+            baudRate,
+            timeoutInterByte == 0 ? serial::Timeout::max() : timeoutInterByte,
+            timeoutRead,
+            0,
+            1000,
+            0,
+            8,
+            0,
+            0,
+            0
+        );
+        return serial;
+      }
+
+      static double getPercentile(std::vector<double>& values, const double& percentile) {
+        if (values.empty()) {
+          return 0;
+        }
+        size_t index = std::min(values.size() - 1, static_cast<size_t>(percentile * static_cast<double>(values.size())));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values.at(index);
+      }
+
+  };
+
+  // Ptys do not pace bytes at the configured baud rate, so 'baud' only covers the port setup path and
+  // these numbers are the library and kernel overhead ceiling rather than line throughput.
+  // 12000000 has no 'Bxxxx' constant and is applied through termios2.
+  static void SerialBenchmarks_writeBytes(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, static_cast<unsigned int>(state.range(1)), 0, 100);
+
+    std::atomic<bool> stop = false;
+    std::thread drain([&pty, &stop] {
+      while (!stop.load()) {
+        pty.read(65536, 10);
+      }
+    });
+
+    std::vector<unsigned char> chunk(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(serial->writeBytes(chunk));
+    }
+
+    stop.store(true);
+    drain.join();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  static void SerialBenchmarks_readBytes(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, 115200, static_cast<unsigned int>(state.range(1)), static_cast<unsigned int>(state.range(2)));
+
+    std::atomic<bool> stop = false;
+    std::atomic<bool> done = false;
+    std::thread feed([&pty, &stop, &done] {
+      std::vector<unsigned char> block(4096, 'x');
+      while (!stop.load()) {
+        pty.write(block);
+      }
+      done.store(true);
+    });
+
+    size_t received = 0;
+    for (auto _ : state) {
+      std::vector<unsigned char> bytes = serial->readBytes(static_cast<size_t>(state.range(0)));
+      received += bytes.size();
+      benchmark::DoNotOptimize(bytes.data());
+    }
+
+    stop.store(true);
+    while (!done.load()) {
+      serial->readBytes(4096);
+    }
+    feed.join();
+    state.SetBytesProcessed(static_cast<int64_t>(received));
+  }
+
+  static void SerialBenchmarks_readBytesTimeout(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, 115200, 0, static_cast<unsigned int>(state.range(0)));
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(serial->readBytes(1));
+    }
+
+    state.counters["timeout_ms"] = static_cast<double>(state.range(0));
+  }
+
+  static void SerialBenchmarks_echoRoundTrip(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, 115200, 0, 1000);
+    size_t size = static_cast<size_t>(state.range(0));
+    std::string journalPath = (std::filesystem::temp_directory_path() / "exqudens-serial-bench.journal").string();
+    if (state.range(1) != 0) {
+      serial->setJournal(std::make_shared<Journal>(journalPath, 256 * 1024 * 1024));
+    }
+
+    pty.startEcho();
+
+    std::vector<unsigned char> message(size, 'x');
+    std::vector<double> samples;
+    for (auto _ : state) {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      serial->writeBytes(message);
+      std::vector<unsigned char> bytes = serial->readBytes(size);
+      samples.emplace_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+      if (bytes.size() != size) {
+        state.SkipWithError("echo timed out");
+        break;
+      }
+    }
+
+    pty.stop();
+    serial->setJournal(nullptr);
+    std::filesystem::remove(journalPath);
+    state.counters["p50_us"] = SerialBenchmarks::getPercentile(samples, 0.50);
+    state.counters["p90_us"] = SerialBenchmarks::getPercentile(samples, 0.90);
+    state.counters["p99_us"] = SerialBenchmarks::getPercentile(samples, 0.99);
+    state.counters["max_us"] = SerialBenchmarks::getPercentile(samples, 1.0);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+  // With one cpu the busy-poll competes with the echo thread of the pty, 'cpu' pinning is left to real hardware runs.
+  static void SerialBenchmarks_lowLatencyRoundTrip(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, 115200, 0, 1000);
+    size_t size = static_cast<size_t>(state.range(0));
+    serial->setLowLatency({.enabled = state.range(1) != 0, .busyPoll = std::chrono::microseconds(50)});
+
+    pty.startEcho();
+
+    std::vector<unsigned char> message(size, 'x');
+    std::vector<double> samples;
+    for (auto _ : state) {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      serial->writeBytes(message);
+      std::vector<unsigned char> bytes = serial->readBytes(size);
+      samples.emplace_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+      if (bytes.size() != size) {
+        state.SkipWithError("echo timed out");
+        break;
+      }
+    }
+
+    pty.stop();
+    state.counters["p50_us"] = SerialBenchmarks::getPercentile(samples, 0.50);
+    state.counters["p99_us"] = SerialBenchmarks::getPercentile(samples, 0.99);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+  // The device answers every request 1ms after receiving it and accepts the next ones meanwhile,
+  // so with depth 1 the link idles for the whole processing time and deeper pipelines hide it.
+  static void SerialBenchmarks_pipelineDepth(benchmark::State& state) {
+    PtyDevice pty;
+    std::shared_ptr<Serial> serial = SerialBenchmarks::open(pty, 115200, 0, 100);
+    serial->setThreadSafe(true);
+    size_t depth = static_cast<size_t>(state.range(0));
+    TransactionEngine engine(
+        serial,
+        [](std::span<const std::byte> frame) { return static_cast<TransactionEngine::Key>(frame[0]); },
+        [](std::span<const std::byte> head) { return head.size() < 2 ? size_t(2) : 2 + static_cast<size_t>(head[1]); },
+        depth
+    );
+
+    pty.startDelayedEcho(std::chrono::milliseconds(1));
+
+    std::vector<std::byte> request(18, std::byte('x'));
+    request.at(1) = std::byte(16);
+    std::vector<std::future<std::vector<std::byte>>> futures;
+    for (auto _ : state) {
+      futures.clear();
+      for (size_t i = 0; i < 64; i++) {
+        request.at(0) = std::byte(i);
+        futures.emplace_back(engine.submit(request, std::chrono::milliseconds(1000)));
+      }
+      for (std::future<std::vector<std::byte>>& future : futures) {
+        future.get();
+      }
+    }
+
+    engine.stop();
+    pty.stop();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 64);
+  }
+
+  BENCHMARK(SerialBenchmarks_writeBytes)
+      ->ArgNames({"chunk", "baud"})
+      ->ArgsProduct({{16, 256, 4096, 65536}, {9600, 115200, 921600, 2000000, 3000000, 12000000}})
+      ->UseRealTime();
+
+  BENCHMARK(SerialBenchmarks_readBytes)
+      ->ArgNames({"chunk", "inter_byte_ms", "read_ms"})
+      ->ArgsProduct({{16, 256, 4096, 65536}, {0, 10}, {1, 100}})
+      ->UseRealTime();
+
+  BENCHMARK(SerialBenchmarks_readBytesTimeout)
+      ->ArgName("read_ms")
+      ->Arg(1)->Arg(10)
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+
+  BENCHMARK(SerialBenchmarks_echoRoundTrip)
+      ->ArgNames({"size", "journal"})
+      ->ArgsProduct({{1, 16, 256, 4096}, {0, 1}})
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+  BENCHMARK(SerialBenchmarks_lowLatencyRoundTrip)
+      ->ArgNames({"size", "low_latency"})
+      ->ArgsProduct({{1, 16, 256}, {0, 1}})
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+  BENCHMARK(SerialBenchmarks_pipelineDepth)
+      ->ArgName("depth")
+      ->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+
+}
+
+#endif
@@ -0,0 +1,142 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <benchmark/benchmark.h>
+
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/SerialHub.hpp"
+
+namespace exqudens {
+
+  class SerialHubBenchmarks {
+
+    public:
+
+      inline static const size_t MESSAGE_SIZE = 16;
+
+      static double getProcessCpuSeconds() {
+        rusage usage = {};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+            + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+      }
+
+      static void openPorts(
+          const size_t& size,
+          const unsigned int& timeout,
+          std::vector<std::unique_ptr<PtyDevice>>& ptys,
+          std::vector<std::shared_ptr<Serial>>& serials
+      ) {
+        for (size_t i = 0; i < size; i++) {
+          ptys.emplace_back(std::make_unique<PtyDevice>());
+          serials.emplace_back(std::make_shared<Serial>());
+          serials.back()->open(ptys.back()->getSlavePath(), timeout);
+        }
+      }
+
+      static void run(
+          benchmark::State& state,
+          std::vector<std::unique_ptr<PtyDevice>>& ptys,
+          std::atomic<size_t>& received
+      ) {
+        std::vector<unsigned char> message(MESSAGE_SIZE, 'x');
+        size_t expected = 0;
+        double cpuStart = getProcessCpuSeconds();
+        for (auto _ : state) {
+          expected += ptys.size() * message.size();
+          for (std::unique_ptr<PtyDevice>& pty : ptys) {
+            pty->write(message);
+          }
+          size_t value = received.load();
+          while (value < expected) {
+            received.wait(value);
+            value = received.load();
+          }
+        }
+        double cpu = getProcessCpuSeconds() - cpuStart;
+        double messages = static_cast<double>(state.iterations()) * static_cast<double>(ptys.size());
+        state.counters["ports"] = static_cast<double>(ptys.size());
+        state.counters["cpu_us_per_port_message"] = messages > 0 ? cpu * 1000000.0 / messages : 0;
+        state.SetItemsProcessed(static_cast<int64_t>(messages));
+      }
+
+  };
+
+  static void SerialHubBenchmarks_threadPerPort(benchmark::State& state) {
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    SerialHubBenchmarks::openPorts(static_cast<size_t>(state.range(0)), 100, ptys, serials);
+
+    std::atomic<size_t> received = 0;
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> threads;
+    for (std::shared_ptr<Serial>& serial : serials) {
+      threads.emplace_back([serial, &received, &stop] {
+        std::byte buffer[SerialHubBenchmarks::MESSAGE_SIZE];
+        while (!stop.load()) {
+          size_t length = serial->readInto(buffer);
+          if (length > 0) {
+            received.fetch_add(length);
+            received.notify_one();
+          }
+        }
+      });
+    }
+
+    SerialHubBenchmarks::run(state, ptys, received);
+
+    stop.store(true);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  static void SerialHubBenchmarks_hub(benchmark::State& state) {
+    std::vector<std::unique_ptr<PtyDevice>> ptys;
+    std::vector<std::shared_ptr<Serial>> serials;
+    SerialHubBenchmarks::openPorts(static_cast<size_t>(state.range(0)), 100, ptys, serials);
+
+    std::atomic<size_t> received = 0;
+    SerialHub hub(static_cast<size_t>(state.range(1)));
+    for (std::shared_ptr<Serial>& serial : serials) {
+      hub.add(serial, SerialHub::Handler {
+        .onRead = [&received](std::span<const std::byte> bytes) {
+          received.fetch_add(bytes.size());
+          received.notify_one();
+        },
+        .onWritable = {},
+        .onError = {}
+      });
+    }
+
+    SerialHubBenchmarks::run(state, ptys, received);
+
+    hub.stop();
+  }
+
+  BENCHMARK(SerialHubBenchmarks_threadPerPort)
+      ->ArgName("ports")
+      ->Arg(8)->Arg(64)->Arg(256)
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+  BENCHMARK(SerialHubBenchmarks_hub)
+      ->ArgNames({"ports", "threads"})
+      ->Args({8, 1})->Args({64, 1})->Args({256, 1})->Args({256, 2})
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+
+}
+
+#endif
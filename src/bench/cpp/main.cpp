@@ -0,0 +1,12 @@
+#include <benchmark/benchmark.h>
+
+// include benchmark files
+#include "exqudens/serial/SerialHubBenchmarks.hpp"
+#include "exqudens/serial/IoUringBenchmarks.hpp"
+#include "exqudens/serial/FramingBenchmarks.hpp"
+#include "exqudens/serial/CrcBenchmarks.hpp"
+#include "exqudens/serial/SerialBenchmarks.hpp"
+#include "exqudens/serial/BroadcasterBenchmarks.hpp"
+#include "exqudens/serial/PortAggregatorBenchmarks.hpp"
+
+BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+/*!
+* @file AsyncSerial.cpp
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+#include "exqudens/serial/AsyncSerial.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    AsyncSerial::AsyncSerial(
+        EventLoop& loop,
+        const std::shared_ptr<Serial>& serial,
+        const size_t& bufferSize
+    ):
+        loop(loop),
+        serial(serial)
+    {
+        try {
+            if (!serial) {
+                throw std::invalid_argument("serial");
+            }
+            if (bufferSize == 0) {
+                throw std::invalid_argument("bufferSize");
+            }
+            buffer.resize(bufferSize);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::shared_ptr<Serial> AsyncSerial::getSerial() const {
+        return serial;
+    }
+
+    Task<size_t> AsyncSerial::readAsync(std::span<std::byte> bytes, const unsigned int& timeout) {
+        try {
+            if (bytes.empty()) {
+                co_return 0;
+            }
+            if (bufferEnd > bufferBegin) {
+                size_t size = std::min(bytes.size(), bufferEnd - bufferBegin);
+                std::memcpy(bytes.data(), buffer.data() + bufferBegin, size);
+                bufferBegin += size;
+                co_return size;
+            }
+            int fd = getHandle();
+            std::optional<std::chrono::steady_clock::time_point> deadline = toDeadline(timeout);
+            while (true) {
+                ssize_t length = ::read(fd, bytes.data(), bytes.size());
+                if (length > 0) {
+                    record(Journal::Direction::READ, bytes.first(static_cast<size_t>(length)));
+                    co_return static_cast<size_t>(length);
+                } else if (length == 0) {
+                    throw std::runtime_error("end of file");
+                } else if (errno == EINTR) {
+                    continue;
+                } else if (errno != EAGAIN) {
+                    throw std::system_error(errno, std::generic_category(), "read");
+                }
+                if (!co_await loop.readable(fd, deadline)) {
+                    co_return 0;
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    Task<std::span<const std::byte>> AsyncSerial::readUntilAsync(const std::byte& delimiter, const unsigned int& timeout) {
+        try {
+            if (bufferBegin == bufferEnd) {
+                bufferBegin = 0;
+                bufferEnd = 0;
+            }
+            int fd = getHandle();
+            std::optional<std::chrono::steady_clock::time_point> deadline = toDeadline(timeout);
+            size_t scanned = bufferBegin;
+            while (true) {
+                size_t index = scanned + ByteScanner::find(std::span<const std::byte>(buffer.data() + scanned, bufferEnd - scanned), delimiter);
+                if (index < bufferEnd) {
+                    std::span<const std::byte> result(buffer.data() + bufferBegin, index + 1 - bufferBegin);
+                    bufferBegin += result.size();
+                    co_return result;
+                }
+                scanned = bufferEnd;
+                if (bufferEnd == buffer.size()) {
+                    if (bufferBegin == 0) {
+                        // Handed over without the delimiter like in 'Serial::readUntil', the next call goes on from the following byte.
+                        bufferBegin = bufferEnd;
+                        co_return std::span<const std::byte>(buffer.data(), bufferEnd);
+                    }
+                    std::memmove(buffer.data(), buffer.data() + bufferBegin, bufferEnd - bufferBegin);
+                    bufferEnd -= bufferBegin;
+                    scanned -= bufferBegin;
+                    bufferBegin = 0;
+                }
+                ssize_t length = ::read(fd, buffer.data() + bufferEnd, buffer.size() - bufferEnd);
+                if (length > 0) {
+                    record(Journal::Direction::READ, std::span<const std::byte>(buffer.data() + bufferEnd, static_cast<size_t>(length)));
+                    bufferEnd += static_cast<size_t>(length);
+                    continue;
+                } else if (length == 0) {
+                    throw std::runtime_error("end of file");
+                } else if (errno == EINTR) {
+                    continue;
+                } else if (errno != EAGAIN) {
+                    throw std::system_error(errno, std::generic_category(), "read");
+                }
+                if (!co_await loop.readable(fd, deadline)) {
+                    co_return std::span<const std::byte>();
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    Task<size_t> AsyncSerial::writeAsync(std::span<const std::byte> bytes, const unsigned int& timeout) {
+        try {
+            int fd = getHandle();
+            std::optional<std::chrono::steady_clock::time_point> deadline = toDeadline(timeout);
+            size_t written = 0;
+            while (written < bytes.size()) {
+                ssize_t length = ::write(fd, bytes.data() + written, bytes.size() - written);
+                if (length >= 0) {
+                    record(Journal::Direction::WRITE, bytes.subspan(written, static_cast<size_t>(length)));
+                    written += static_cast<size_t>(length);
+                    continue;
+                } else if (errno == EINTR) {
+                    continue;
+                } else if (errno != EAGAIN) {
+                    throw std::system_error(errno, std::generic_category(), "write");
+                }
+                if (!co_await loop.writable(fd, deadline)) {
+                    break;
+                }
+            }
+            co_return written;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    int AsyncSerial::getHandle() const {
+        int fd = serial->getNativeHandle();
+        if (fd < 0) {
+            throw std::runtime_error("serial is not open");
+        }
+        return fd;
+    }
+
+    void AsyncSerial::record(const Journal::Direction& direction, std::span<const std::byte> bytes) const noexcept {
+        std::shared_ptr<Journal> journal = serial->getJournal();
+        if (journal) {
+            journal->append(direction, bytes);
+        }
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> AsyncSerial::toDeadline(const unsigned int& timeout) {
+        if (timeout == 0) {
+            return std::nullopt;
+        }
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    }
+
+}
+
+#undef CALL_INFO
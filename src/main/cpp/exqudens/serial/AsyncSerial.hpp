@@ -0,0 +1,95 @@
+/*!
+* @file AsyncSerial.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/IAsyncSerial.hpp"
+#include "exqudens/serial/EventLoop.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Coroutine i/o on the native handle of an open port driven by an event loop (Linux only).
+    *
+    * Operations must be awaited from tasks running on the loop, at most one read and one write at a time.
+    * Bytes consumed here are not seen by the blocking api of the port and vice versa,
+    * so the reader thread of the port must not be running. The bytes are recorded to the journal of the port.
+    */
+    class EXQUDENS_SERIAL_EXPORT AsyncSerial : public IAsyncSerial {
+
+        private:
+
+            EventLoop& loop;
+            std::shared_ptr<Serial> serial = nullptr;
+            std::vector<std::byte> buffer;
+            size_t bufferBegin = 0;
+            size_t bufferEnd = 0;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            AsyncSerial(
+                EventLoop& loop,                        //!< A loop running the awaiting tasks, must outlive this object.
+                const std::shared_ptr<Serial>& serial,  //!< A port, opened before the first operation.
+                const size_t& bufferSize = 4096         //!< A read buffer size, upper bound of one 'readUntilAsync' result.
+            );
+
+            AsyncSerial(const AsyncSerial&) = delete;
+
+            AsyncSerial& operator=(const AsyncSerial&) = delete;
+
+            /*!
+            * Gets port.
+            *
+            * @return A port.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::shared_ptr<Serial> getSerial() const;
+
+            EXQUDENS_SERIAL_INLINE
+            Task<size_t> readAsync(
+                std::span<std::byte> bytes,
+                const unsigned int& timeout
+            ) override;
+
+            EXQUDENS_SERIAL_INLINE
+            Task<std::span<const std::byte>> readUntilAsync(
+                const std::byte& delimiter,
+                const unsigned int& timeout
+            ) override;
+
+            EXQUDENS_SERIAL_INLINE
+            Task<size_t> writeAsync(
+                std::span<const std::byte> bytes,
+                const unsigned int& timeout
+            ) override;
+
+            EXQUDENS_SERIAL_INLINE
+            ~AsyncSerial() noexcept override = default;
+
+        private:
+
+            int getHandle() const;
+
+            void record(const Journal::Direction& direction, std::span<const std::byte> bytes) const noexcept;
+
+            static std::optional<std::chrono::steady_clock::time_point> toDeadline(const unsigned int& timeout);
+
+    };
+
+}
@@ -0,0 +1,109 @@
+/*!
+* @file Broadcaster.cpp
+*/
+
+#include <cerrno>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "exqudens/serial/Broadcaster.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    Broadcaster::Broadcaster(const unsigned int& entries) {
+        try {
+            if (entries == 0) {
+                throw std::invalid_argument("entries");
+            }
+            if (IoUring::isSupported()) {
+                ring = std::make_unique<IoUring>(entries);
+                completions.resize(entries);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<Broadcaster::Result> Broadcaster::broadcast(const std::vector<std::shared_ptr<Serial>>& ports, std::span<const std::byte> payload) {
+        try {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<Result> results(ports.size());
+            std::vector<int> handles(ports.size(), -1);
+            for (size_t i = 0; i < ports.size(); i++) {
+                if (!ports.at(i) || !ports.at(i)->isOpen()) {
+                    results.at(i).error = std::make_error_code(std::errc::not_connected);
+                    continue;
+                }
+                handles.at(i) = ports.at(i)->getNativeHandle();
+            }
+            if (payload.empty()) {
+                return results;
+            }
+
+            if (ring) {
+                size_t next = 0;
+                while (next < ports.size()) {
+                    unsigned int prepared = 0;
+                    for (; next < ports.size() && prepared < completions.size(); next++) {
+                        if (handles.at(next) < 0) {
+                            continue;
+                        }
+                        if (!ring->prepareWrite(handles.at(next), payload, next)) {
+                            break;
+                        }
+                        prepared++;
+                    }
+                    if (prepared == 0) {
+                        break;
+                    }
+                    ring->submit(prepared);
+                    size_t reaped = 0;
+                    while (reaped < prepared) {
+                        size_t count = ring->reap(std::span<IoUring::Completion>(completions).first(prepared - reaped));
+                        for (size_t i = 0; i < count; i++) {
+                            Result& result = results.at(completions.at(i).userData);
+                            if (completions.at(i).result >= 0) {
+                                result.written = static_cast<size_t>(completions.at(i).result);
+                            } else if (completions.at(i).result != -EAGAIN) {
+                                result.error = std::error_code(-completions.at(i).result, std::generic_category());
+                            }
+                        }
+                        reaped += count;
+                        if (reaped < prepared) {
+                            ring->submit(static_cast<unsigned int>(prepared - reaped));
+                        }
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < ports.size(); i++) {
+                Result& result = results.at(i);
+                if (result.written > 0) {
+                    std::shared_ptr<Journal> journal = ports.at(i)->getJournal();
+                    if (journal) {
+                        journal->append(Journal::Direction::WRITE, payload.first(result.written));
+                    }
+                }
+                if (result.error || result.written == payload.size()) {
+                    continue;
+                }
+                std::error_code error;
+                result.written += ports.at(i)->writeFrom(payload.subspan(result.written), error);
+                result.error = error;
+            }
+            return results;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool Broadcaster::isIoUringEnabled() const {
+        return (bool) ring;
+    }
+
+}
+
+#undef CALL_INFO
@@ -0,0 +1,86 @@
+/*!
+* @file Broadcaster.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/IoUring.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Writes the same payload to many open ports at once (Linux only).
+    *
+    * The writes to all ports are queued on a private io_uring, each pointing at the one caller buffer,
+    * and handed to the kernel with a single system call, so the start time skew between ports does not grow
+    * with a system call per port. A port the kernel could not take the whole payload from at once, because its
+    * output buffer is full, gets the rest through its own 'writeFrom' with the port write timeout.
+    * Without io_uring support every port is written through 'writeFrom' in turn.
+    *
+    * The bytes are recorded to the journal of each port, a broadcast must not overlap other writes to the same ports.
+    */
+    class EXQUDENS_SERIAL_EXPORT Broadcaster {
+
+        public:
+
+            struct Result {
+                size_t written = 0;     //!< A number of payload bytes written to the port.
+                std::error_code error;  //!< A failure reason, cleared on success.
+            };
+
+        private:
+
+            std::unique_ptr<IoUring> ring = nullptr;
+            std::vector<IoUring::Completion> completions;
+            std::mutex mutex;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit Broadcaster(
+                const unsigned int& entries = 256 //!< A number of writes handed to the kernel per system call.
+            );
+
+            Broadcaster(const Broadcaster&) = delete;
+
+            Broadcaster& operator=(const Broadcaster&) = delete;
+
+            /*!
+            * Writes the payload to every port and waits until all writes finished.
+            * A closed or failing port does not stop the writes to the other ones.
+            *
+            * @return A results in the order of the ports.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<Result> broadcast(
+                const std::vector<std::shared_ptr<Serial>>& ports,  //!< An open ports.
+                std::span<const std::byte> payload                  //!< A data to be written to every port.
+            );
+
+            /*!
+            * Gets the io_uring backend status.
+            *
+            * @return Returns @b true if the writes are batched through io_uring, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool isIoUringEnabled() const;
+
+    };
+
+}
@@ -0,0 +1,182 @@
+/*!
+* @file ByteScanner.cpp
+*/
+
+#include <bit>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define EXQUDENS_SERIAL_SCANNER_SSE2
+#define EXQUDENS_SERIAL_SCANNER_AVX2
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define EXQUDENS_SERIAL_SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "exqudens/serial/ByteScanner.hpp"
+
+namespace exqudens {
+
+    size_t ByteScanner::find(std::span<const std::byte> bytes, const std::byte& value) {
+        static const Function function = resolve();
+        return function(bytes.data(), bytes.size(), value);
+    }
+
+    size_t ByteScanner::findAny(std::span<const std::byte> bytes, const std::byte& first, const std::byte& second) {
+        static const AnyFunction function = resolveAny();
+        return function(bytes.data(), bytes.size(), first, second);
+    }
+
+    size_t ByteScanner::findScalar(std::span<const std::byte> bytes, const std::byte& value) {
+        return scalar(bytes.data(), bytes.size(), value);
+    }
+
+    std::string ByteScanner::getInstructionSet() {
+        Function function = resolve();
+        if (function == &ByteScanner::avx2) {
+            return "avx2";
+        }
+        if (function == &ByteScanner::sse2) {
+            return "sse2";
+        }
+        return "scalar";
+    }
+
+    ByteScanner::Function ByteScanner::resolve() {
+#if defined(EXQUDENS_SERIAL_SCANNER_AVX2)
+        if (__builtin_cpu_supports("avx2")) {
+            return &ByteScanner::avx2;
+        }
+#endif
+#if defined(EXQUDENS_SERIAL_SCANNER_SSE2)
+        return &ByteScanner::sse2;
+#else
+        return &ByteScanner::scalar;
+#endif
+    }
+
+    ByteScanner::AnyFunction ByteScanner::resolveAny() {
+#if defined(EXQUDENS_SERIAL_SCANNER_AVX2)
+        if (__builtin_cpu_supports("avx2")) {
+            return &ByteScanner::avx2Any;
+        }
+#endif
+#if defined(EXQUDENS_SERIAL_SCANNER_SSE2)
+        return &ByteScanner::sse2Any;
+#else
+        return &ByteScanner::scalarAny;
+#endif
+    }
+
+    size_t ByteScanner::scalar(const std::byte* data, size_t size, std::byte value) {
+        for (size_t i = 0; i < size; i++) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+    size_t ByteScanner::scalarAny(const std::byte* data, size_t size, std::byte first, std::byte second) {
+        for (size_t i = 0; i < size; i++) {
+            if (data[i] == first || data[i] == second) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+#if defined(EXQUDENS_SERIAL_SCANNER_SSE2)
+    size_t ByteScanner::sse2(const std::byte* data, size_t size, std::byte value) {
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+            if (mask != 0) {
+                return i + static_cast<size_t>(std::countr_zero(mask));
+            }
+        }
+        return i + scalar(data + i, size - i, value);
+    }
+
+    size_t ByteScanner::sse2Any(const std::byte* data, size_t size, std::byte first, std::byte second) {
+        const __m128i firstNeedle = _mm_set1_epi8(static_cast<char>(first));
+        const __m128i secondNeedle = _mm_set1_epi8(static_cast<char>(second));
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i equal = _mm_or_si128(_mm_cmpeq_epi8(chunk, firstNeedle), _mm_cmpeq_epi8(chunk, secondNeedle));
+            unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(equal));
+            if (mask != 0) {
+                return i + static_cast<size_t>(std::countr_zero(mask));
+            }
+        }
+        return i + scalarAny(data + i, size - i, first, second);
+    }
+#else
+    size_t ByteScanner::sse2(const std::byte* data, size_t size, std::byte value) {
+        return scalar(data, size, value);
+    }
+
+    size_t ByteScanner::sse2Any(const std::byte* data, size_t size, std::byte first, std::byte second) {
+        return scalarAny(data, size, first, second);
+    }
+#endif
+
+#if defined(EXQUDENS_SERIAL_SCANNER_AVX2)
+    __attribute__((target("avx2")))
+    size_t ByteScanner::avx2(const std::byte* data, size_t size, std::byte value) {
+        const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64) {
+            __m256i first = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+            __m256i second = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32)), needle);
+            if (!_mm256_testz_si256(_mm256_or_si256(first, second), _mm256_or_si256(first, second))) {
+                unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(first));
+                if (mask != 0) {
+                    return i + static_cast<size_t>(std::countr_zero(mask));
+                }
+                mask = static_cast<unsigned int>(_mm256_movemask_epi8(second));
+                return i + 32 + static_cast<size_t>(std::countr_zero(mask));
+            }
+        }
+        for (; i + 32 <= size; i += 32) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+            if (mask != 0) {
+                return i + static_cast<size_t>(std::countr_zero(mask));
+            }
+        }
+        return i + sse2(data + i, size - i, value);
+    }
+
+    __attribute__((target("avx2")))
+    size_t ByteScanner::avx2Any(const std::byte* data, size_t size, std::byte first, std::byte second) {
+        const __m256i firstNeedle = _mm256_set1_epi8(static_cast<char>(first));
+        const __m256i secondNeedle = _mm256_set1_epi8(static_cast<char>(second));
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i equal = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, firstNeedle), _mm256_cmpeq_epi8(chunk, secondNeedle));
+            unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(equal));
+            if (mask != 0) {
+                return i + static_cast<size_t>(std::countr_zero(mask));
+            }
+        }
+        return i + sse2Any(data + i, size - i, first, second);
+    }
+#else
+    size_t ByteScanner::avx2(const std::byte* data, size_t size, std::byte value) {
+        return sse2(data, size, value);
+    }
+
+    size_t ByteScanner::avx2Any(const std::byte* data, size_t size, std::byte first, std::byte second) {
+        return sse2Any(data, size, first, second);
+    }
+#endif
+
+}
+
+#undef EXQUDENS_SERIAL_SCANNER_SSE2
+#undef EXQUDENS_SERIAL_SCANNER_AVX2
@@ -0,0 +1,91 @@
+/*!
+* @file ByteScanner.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Byte search with the widest vector instruction set of the running cpu (AVX2, SSE2 or scalar),
+    * selected once on the first call.
+    */
+    class EXQUDENS_SERIAL_EXPORT ByteScanner {
+
+        private:
+
+            using Function = size_t (*)(const std::byte* data, size_t size, std::byte value);
+
+            using AnyFunction = size_t (*)(const std::byte* data, size_t size, std::byte first, std::byte second);
+
+        public:
+
+            /*!
+            * Finds the first occurrence of a byte.
+            *
+            * @return An index of the first occurrence, 'bytes.size()' if not found.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t find(
+                std::span<const std::byte> bytes,   //!< A bytes to be searched.
+                const std::byte& value              //!< A byte to be found.
+            );
+
+            /*!
+            * Finds the first occurrence of any of two bytes.
+            *
+            * @return An index of the first occurrence, 'bytes.size()' if not found.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t findAny(
+                std::span<const std::byte> bytes,   //!< A bytes to be searched.
+                const std::byte& first,             //!< A byte to be found.
+                const std::byte& second             //!< Another byte to be found.
+            );
+
+            /*!
+            * Finds the first occurrence of a byte without vector instructions.
+            *
+            * @return An index of the first occurrence, 'bytes.size()' if not found.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t findScalar(
+                std::span<const std::byte> bytes,   //!< A bytes to be searched.
+                const std::byte& value              //!< A byte to be found.
+            );
+
+            /*!
+            * Gets name of the instruction set selected for 'find'.
+            *
+            * @return One of "avx2", "sse2" or "scalar".
+            */
+            EXQUDENS_SERIAL_INLINE
+            static std::string getInstructionSet();
+
+        private:
+
+            static Function resolve();
+
+            static AnyFunction resolveAny();
+
+            static size_t scalar(const std::byte* data, size_t size, std::byte value);
+
+            static size_t sse2(const std::byte* data, size_t size, std::byte value);
+
+            static size_t avx2(const std::byte* data, size_t size, std::byte value);
+
+            static size_t scalarAny(const std::byte* data, size_t size, std::byte first, std::byte second);
+
+            static size_t sse2Any(const std::byte* data, size_t size, std::byte first, std::byte second);
+
+            static size_t avx2Any(const std::byte* data, size_t size, std::byte first, std::byte second);
+
+    };
+
+}
@@ -0,0 +1,93 @@
+/*!
+* @file Cobs.cpp
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "exqudens/serial/Cobs.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define MAX_BLOCK_SIZE 254
+
+namespace exqudens {
+
+    size_t Cobs::getMaxEncodedSize(const size_t& size) {
+        return size + size / MAX_BLOCK_SIZE + 1;
+    }
+
+    size_t Cobs::encode(std::span<std::byte> buffer, const size_t& size) {
+        try {
+            size_t required = getMaxEncodedSize(size);
+            if (buffer.size() < required) {
+                throw std::length_error("buffer size: " + std::to_string(buffer.size()) + " less than: " + std::to_string(required));
+            }
+
+            // The payload is moved behind the worst case overhead, so the output never overtakes unread input.
+            size_t overhead = required - size;
+            std::memmove(buffer.data() + overhead, buffer.data(), size);
+            const std::byte* input = buffer.data() + overhead;
+            const std::byte* end = input + size;
+            std::byte* output = buffer.data();
+
+            while (true) {
+                size_t limit = std::min<size_t>(static_cast<size_t>(end - input), MAX_BLOCK_SIZE);
+                size_t run = ByteScanner::find(std::span<const std::byte>(input, limit), std::byte(0));
+                std::memmove(output + 1, input, run);
+                *output = static_cast<std::byte>(run + 1);
+                output += run + 1;
+                input += run;
+                if (run < limit) {
+                    input++;
+                    continue;
+                }
+                if (run == MAX_BLOCK_SIZE && input != end) {
+                    continue;
+                }
+                break;
+            }
+
+            return static_cast<size_t>(output - buffer.data());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Cobs::decode(std::span<std::byte> buffer) {
+        try {
+            if (ByteScanner::find(buffer, std::byte(0)) != buffer.size()) {
+                throw std::invalid_argument("zero byte in encoded data");
+            }
+
+            const std::byte* input = buffer.data();
+            const std::byte* end = input + buffer.size();
+            std::byte* output = buffer.data();
+
+            while (input < end) {
+                size_t code = static_cast<size_t>(*input++);
+                size_t run = code - 1;
+                if (run > static_cast<size_t>(end - input)) {
+                    throw std::invalid_argument("block size: " + std::to_string(run) + " exceeds frame");
+                }
+                std::memmove(output, input, run);
+                output += run;
+                input += run;
+                if (code != MAX_BLOCK_SIZE + 1 && input < end) {
+                    *output++ = std::byte(0);
+                }
+            }
+
+            return static_cast<size_t>(output - buffer.data());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+}
+
+#undef CALL_INFO
+#undef MAX_BLOCK_SIZE
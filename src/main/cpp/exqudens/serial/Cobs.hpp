@@ -0,0 +1,58 @@
+/*!
+* @file Cobs.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Consistent overhead byte stuffing, encoded data contains no zero bytes so a zero byte delimits frames.
+    */
+    class EXQUDENS_SERIAL_EXPORT Cobs {
+
+        public:
+
+            /*!
+            * Gets maximal encoded size of a payload, without the delimiter.
+            *
+            * @return A size in bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t getMaxEncodedSize(
+                const size_t& size //!< A payload size in bytes.
+            );
+
+            /*!
+            * Encodes a payload in place.
+            *
+            * @return An encoded size in bytes, without the delimiter.
+            *
+            * @throws std::runtime_error with std::length_error nested if the buffer is smaller than 'getMaxEncodedSize(size)'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t encode(
+                std::span<std::byte> buffer,    //!< A buffer holding the payload in its first 'size' bytes.
+                const size_t& size              //!< A payload size in bytes.
+            );
+
+            /*!
+            * Decodes a frame in place.
+            *
+            * @return A payload size in bytes, the payload occupies the beginning of the buffer.
+            *
+            * @throws std::runtime_error with std::invalid_argument nested if the frame is malformed.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t decode(
+                std::span<std::byte> buffer //!< A buffer holding one encoded frame without the delimiter.
+            );
+
+    };
+
+}
@@ -0,0 +1,186 @@
+/*!
+* @file Crc.cpp
+*/
+
+#include <array>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define EXQUDENS_SERIAL_CRC_SSE42
+#include <nmmintrin.h>
+#endif
+
+#include "exqudens/serial/Crc.hpp"
+
+namespace exqudens {
+
+    namespace {
+
+        constexpr std::array<std::array<uint16_t, 256>, 8> createCrc16Tables() {
+            std::array<std::array<uint16_t, 256>, 8> result = {};
+            for (uint32_t i = 0; i < 256; i++) {
+                uint16_t value = static_cast<uint16_t>(i << 8);
+                for (int bit = 0; bit < 8; bit++) {
+                    value = static_cast<uint16_t>((value & 0x8000) != 0 ? (value << 1) ^ 0x1021 : value << 1);
+                }
+                result[0][i] = value;
+            }
+            for (size_t table = 1; table < result.size(); table++) {
+                for (size_t i = 0; i < 256; i++) {
+                    uint16_t previous = result[table - 1][i];
+                    result[table][i] = static_cast<uint16_t>((previous << 8) ^ result[0][previous >> 8]);
+                }
+            }
+            return result;
+        }
+
+        constexpr std::array<std::array<uint16_t, 256>, 8> createCrc16ModbusTables() {
+            std::array<std::array<uint16_t, 256>, 8> result = {};
+            for (uint32_t i = 0; i < 256; i++) {
+                uint16_t value = static_cast<uint16_t>(i);
+                for (int bit = 0; bit < 8; bit++) {
+                    value = static_cast<uint16_t>((value & 1) != 0 ? (value >> 1) ^ 0xA001 : value >> 1);
+                }
+                result[0][i] = value;
+            }
+            for (size_t table = 1; table < result.size(); table++) {
+                for (size_t i = 0; i < 256; i++) {
+                    uint16_t previous = result[table - 1][i];
+                    result[table][i] = static_cast<uint16_t>((previous >> 8) ^ result[0][previous & 0xFF]);
+                }
+            }
+            return result;
+        }
+
+        constexpr std::array<std::array<uint32_t, 256>, 8> createCrc32cTables() {
+            std::array<std::array<uint32_t, 256>, 8> result = {};
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t value = i;
+                for (int bit = 0; bit < 8; bit++) {
+                    value = (value & 1) != 0 ? (value >> 1) ^ 0x82F63B78u : value >> 1;
+                }
+                result[0][i] = value;
+            }
+            for (size_t table = 1; table < result.size(); table++) {
+                for (size_t i = 0; i < 256; i++) {
+                    uint32_t previous = result[table - 1][i];
+                    result[table][i] = (previous >> 8) ^ result[0][previous & 0xFF];
+                }
+            }
+            return result;
+        }
+
+        constexpr std::array<std::array<uint16_t, 256>, 8> CRC16_TABLES = createCrc16Tables();
+
+        constexpr std::array<std::array<uint16_t, 256>, 8> CRC16_MODBUS_TABLES = createCrc16ModbusTables();
+
+        constexpr std::array<std::array<uint32_t, 256>, 8> CRC32C_TABLES = createCrc32cTables();
+
+    }
+
+    uint16_t Crc::crc16(std::span<const std::byte> bytes, const uint16_t& value) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(bytes.data());
+        size_t size = bytes.size();
+        uint16_t crc = value;
+        while (size >= 8) {
+            crc ^= static_cast<uint16_t>((data[0] << 8) | data[1]);
+            crc = CRC16_TABLES[7][crc >> 8] ^ CRC16_TABLES[6][crc & 0xFF]
+                ^ CRC16_TABLES[5][data[2]] ^ CRC16_TABLES[4][data[3]]
+                ^ CRC16_TABLES[3][data[4]] ^ CRC16_TABLES[2][data[5]]
+                ^ CRC16_TABLES[1][data[6]] ^ CRC16_TABLES[0][data[7]];
+            data += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = static_cast<uint16_t>((crc << 8) ^ CRC16_TABLES[0][(crc >> 8) ^ *data++]);
+        }
+        return crc;
+    }
+
+    uint16_t Crc::crc16Modbus(std::span<const std::byte> bytes, const uint16_t& value) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(bytes.data());
+        size_t size = bytes.size();
+        uint16_t crc = value;
+        while (size >= 8) {
+            crc ^= static_cast<uint16_t>(data[0] | (data[1] << 8));
+            crc = CRC16_MODBUS_TABLES[7][crc & 0xFF] ^ CRC16_MODBUS_TABLES[6][crc >> 8]
+                ^ CRC16_MODBUS_TABLES[5][data[2]] ^ CRC16_MODBUS_TABLES[4][data[3]]
+                ^ CRC16_MODBUS_TABLES[3][data[4]] ^ CRC16_MODBUS_TABLES[2][data[5]]
+                ^ CRC16_MODBUS_TABLES[1][data[6]] ^ CRC16_MODBUS_TABLES[0][data[7]];
+            data += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = static_cast<uint16_t>((crc >> 8) ^ CRC16_MODBUS_TABLES[0][(crc ^ *data++) & 0xFF]);
+        }
+        return crc;
+    }
+
+    uint32_t Crc::crc32c(std::span<const std::byte> bytes, const uint32_t& value) {
+        static const Function function = resolve();
+        return ~function(bytes.data(), bytes.size(), ~value);
+    }
+
+    uint32_t Crc::crc32cSoftware(std::span<const std::byte> bytes, const uint32_t& value) {
+        return ~crc32cTable(bytes.data(), bytes.size(), ~value);
+    }
+
+    bool Crc::isCrc32cAccelerated() {
+        return resolve() == &Crc::crc32cSse42;
+    }
+
+    Crc::Function Crc::resolve() {
+#if defined(EXQUDENS_SERIAL_CRC_SSE42)
+        if (__builtin_cpu_supports("sse4.2")) {
+            return &Crc::crc32cSse42;
+        }
+#endif
+        return &Crc::crc32cTable;
+    }
+
+    uint32_t Crc::crc32cTable(const std::byte* data, size_t size, uint32_t value) {
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(data);
+        uint32_t crc = value;
+        while (size >= 8) {
+            crc ^= static_cast<uint32_t>(input[0]) | (static_cast<uint32_t>(input[1]) << 8)
+                | (static_cast<uint32_t>(input[2]) << 16) | (static_cast<uint32_t>(input[3]) << 24);
+            crc = CRC32C_TABLES[7][crc & 0xFF] ^ CRC32C_TABLES[6][(crc >> 8) & 0xFF]
+                ^ CRC32C_TABLES[5][(crc >> 16) & 0xFF] ^ CRC32C_TABLES[4][crc >> 24]
+                ^ CRC32C_TABLES[3][input[4]] ^ CRC32C_TABLES[2][input[5]]
+                ^ CRC32C_TABLES[1][input[6]] ^ CRC32C_TABLES[0][input[7]];
+            input += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = (crc >> 8) ^ CRC32C_TABLES[0][(crc ^ *input++) & 0xFF];
+        }
+        return crc;
+    }
+
+#if defined(EXQUDENS_SERIAL_CRC_SSE42)
+    __attribute__((target("sse4.2")))
+    uint32_t Crc::crc32cSse42(const std::byte* data, size_t size, uint32_t value) {
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(data);
+        uint64_t crc = value;
+        while (size >= 8) {
+            uint64_t word = 0;
+            std::memcpy(&word, input, sizeof(word));
+            crc = _mm_crc32_u64(crc, word);
+            input += 8;
+            size -= 8;
+        }
+        uint32_t result = static_cast<uint32_t>(crc);
+        while (size-- > 0) {
+            result = _mm_crc32_u8(result, *input++);
+        }
+        return result;
+    }
+#else
+    uint32_t Crc::crc32cSse42(const std::byte* data, size_t size, uint32_t value) {
+        return crc32cTable(data, size, value);
+    }
+#endif
+
+}
+
+#undef EXQUDENS_SERIAL_CRC_SSE42
@@ -0,0 +1,88 @@
+/*!
+* @file Crc.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Table driven (slicing-by-8) checksums, CRC-32C uses the SSE4.2 'crc32' instruction when the running cpu has it.
+    */
+    class EXQUDENS_SERIAL_EXPORT Crc {
+
+        private:
+
+            using Function = uint32_t (*)(const std::byte* data, size_t size, uint32_t value);
+
+        public:
+
+            /*!
+            * Computes CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF, no reflection).
+            *
+            * @return A checksum, passing it as 'value' of the next call continues the computation.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static uint16_t crc16(
+                std::span<const std::byte> bytes,   //!< A bytes.
+                const uint16_t& value = 0xFFFF      //!< An initial value or a result of the previous call.
+            );
+
+            /*!
+            * Computes CRC-16/MODBUS (reflected polynomial 0xA001, initial value 0xFFFF).
+            *
+            * @return A checksum, transmitted low byte first, passing it as 'value' of the next call continues the computation.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static uint16_t crc16Modbus(
+                std::span<const std::byte> bytes,   //!< A bytes.
+                const uint16_t& value = 0xFFFF      //!< An initial value or a result of the previous call.
+            );
+
+            /*!
+            * Computes CRC-32C (Castagnoli, reflected polynomial 0x82F63B78).
+            *
+            * @return A checksum, passing it as 'value' of the next call continues the computation.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static uint32_t crc32c(
+                std::span<const std::byte> bytes,   //!< A bytes.
+                const uint32_t& value = 0           //!< Zero or a result of the previous call.
+            );
+
+            /*!
+            * Computes CRC-32C without the 'crc32' instruction, see 'crc32c'.
+            *
+            * @return A checksum.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static uint32_t crc32cSoftware(
+                std::span<const std::byte> bytes,   //!< A bytes.
+                const uint32_t& value = 0           //!< Zero or a result of the previous call.
+            );
+
+            /*!
+            * Gets hardware acceleration status of 'crc32c'.
+            *
+            * @return @b true if 'crc32c' uses the SSE4.2 'crc32' instruction, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static bool isCrc32cAccelerated();
+
+        private:
+
+            static Function resolve();
+
+            static uint32_t crc32cTable(const std::byte* data, size_t size, uint32_t value);
+
+            static uint32_t crc32cSse42(const std::byte* data, size_t size, uint32_t value);
+
+    };
+
+}
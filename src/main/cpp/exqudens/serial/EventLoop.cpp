@@ -0,0 +1,261 @@
+/*!
+* @file EventLoop.cpp
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "exqudens/serial/EventLoop.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define MAX_EVENTS 64
+
+namespace exqudens {
+
+    EventLoop::EventLoop() {
+        try {
+            epoll = epoll_create1(EPOLL_CLOEXEC);
+            if (epoll < 0) {
+                throw std::system_error(errno, std::generic_category(), "epoll_create1");
+            }
+            wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wakeup < 0) {
+                ::close(epoll);
+                throw std::system_error(errno, std::generic_category(), "eventfd");
+            }
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = wakeup;
+            if (epoll_ctl(epoll, EPOLL_CTL_ADD, wakeup, &event) != 0) {
+                ::close(wakeup);
+                ::close(epoll);
+                throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void EventLoop::spawn(Task<void> task) {
+        try {
+            size_t id = nextTaskId++;
+            Detached detached = detach(this, id, std::move(task));
+            tasks[id] = detached.handle;
+            ready.emplace_back(detached.handle);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void EventLoop::run() {
+        try {
+            epoll_event events[MAX_EVENTS];
+            std::vector<std::coroutine_handle<>> resumable;
+            while (!stopped.load() && !exception && !tasks.empty()) {
+                resumable.swap(ready);
+                for (std::coroutine_handle<>& handle : resumable) {
+                    handle.resume();
+                }
+                resumable.clear();
+                if (tasks.empty() || stopped.load() || exception || !ready.empty()) {
+                    continue;
+                }
+
+                int timeout = -1;
+                if (!deadlines.empty()) {
+                    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadlines.begin()->first - std::chrono::steady_clock::now());
+                    timeout = static_cast<int>(std::max<long long>(0, remaining.count()));
+                }
+                int size = epoll_wait(epoll, events, MAX_EVENTS, timeout);
+                if (size < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "epoll_wait");
+                }
+
+                for (int i = 0; i < size; i++) {
+                    int fd = events[i].data.fd;
+                    if (fd == wakeup) {
+                        uint64_t value = 0;
+                        ssize_t ignored = ::read(wakeup, &value, sizeof(value));
+                        (void) ignored;
+                        continue;
+                    }
+                    auto entry = handles.find(fd);
+                    if (entry == handles.end()) {
+                        continue;
+                    }
+                    Handle& handle = entry->second;
+                    std::vector<Wait*> completed;
+                    if (handle.reader != nullptr && (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0) {
+                        completed.emplace_back(std::exchange(handle.reader, nullptr));
+                    }
+                    if (handle.writer != nullptr && (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0) {
+                        completed.emplace_back(std::exchange(handle.writer, nullptr));
+                    }
+                    for (Wait* wait : completed) {
+                        if (wait->deadline.has_value()) {
+                            deadlines.erase(wait->deadlineEntry);
+                        }
+                        wait->subscribed = false;
+                        ready.emplace_back(wait->handle);
+                    }
+                    update(fd, handle);
+                }
+
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                while (!deadlines.empty() && deadlines.begin()->first <= now) {
+                    Wait* wait = deadlines.begin()->second;
+                    deadlines.erase(deadlines.begin());
+                    Handle& handle = handles.at(wait->fd);
+                    (wait->write ? handle.writer : handle.reader) = nullptr;
+                    wait->subscribed = false;
+                    wait->timedOut = true;
+                    ready.emplace_back(wait->handle);
+                    update(wait->fd, handle);
+                }
+            }
+            stopped.store(false);
+            if (exception) {
+                std::rethrow_exception(std::exchange(exception, nullptr));
+            }
+        } catch (...) {
+            stopped.store(false);
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void EventLoop::stop() {
+        stopped.store(true);
+        uint64_t value = 1;
+        ssize_t ignored = ::write(wakeup, &value, sizeof(value));
+        (void) ignored;
+    }
+
+    size_t EventLoop::getTaskCount() const {
+        return tasks.size();
+    }
+
+    EventLoop::Wait EventLoop::readable(const int& fd, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+        return Wait(this, fd, false, deadline);
+    }
+
+    EventLoop::Wait EventLoop::writable(const int& fd, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+        return Wait(this, fd, true, deadline);
+    }
+
+    EventLoop::~EventLoop() noexcept {
+        std::map<size_t, std::coroutine_handle<>> pending;
+        pending.swap(tasks);
+        for (auto& [id, handle] : pending) {
+            handle.destroy();
+        }
+        ready.clear();
+        for (auto& [fd, handle] : handles) {
+            epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+        }
+        handles.clear();
+        if (wakeup >= 0) {
+            ::close(wakeup);
+            wakeup = -1;
+        }
+        if (epoll >= 0) {
+            ::close(epoll);
+            epoll = -1;
+        }
+    }
+
+    EventLoop::Detached EventLoop::detach(EventLoop* loop, size_t id, Task<void> task) {
+        try {
+            co_await task;
+        } catch (...) {
+            if (!loop->exception) {
+                loop->exception = std::current_exception();
+            }
+        }
+        loop->tasks.erase(id);
+    }
+
+    void EventLoop::subscribe(Wait& wait) {
+        if (wait.fd < 0) {
+            throw std::invalid_argument("fd");
+        }
+        Handle& handle = handles[wait.fd];
+        Wait*& slot = wait.write ? handle.writer : handle.reader;
+        if (slot != nullptr) {
+            throw std::logic_error("fd: " + std::to_string(wait.fd) + " is already awaited for " + (wait.write ? "write" : "read"));
+        }
+        slot = &wait;
+        try {
+            update(wait.fd, handle);
+        } catch (...) {
+            slot = nullptr;
+            if (handle.reader == nullptr && handle.writer == nullptr && handle.events == 0) {
+                handles.erase(wait.fd);
+            }
+            throw;
+        }
+        if (wait.deadline.has_value()) {
+            wait.deadlineEntry = deadlines.emplace(wait.deadline.value(), &wait);
+        }
+        wait.subscribed = true;
+    }
+
+    void EventLoop::unsubscribe(Wait& wait) {
+        auto entry = handles.find(wait.fd);
+        if (entry != handles.end()) {
+            (wait.write ? entry->second.writer : entry->second.reader) = nullptr;
+            try {
+                update(wait.fd, entry->second);
+            } catch (...) {
+            }
+        }
+        if (wait.deadline.has_value()) {
+            deadlines.erase(wait.deadlineEntry);
+        }
+        wait.subscribed = false;
+    }
+
+    void EventLoop::update(const int& fd, Handle& handle) {
+        unsigned int events = 0;
+        if (handle.reader != nullptr) {
+            events |= EPOLLIN | EPOLLRDHUP;
+        }
+        if (handle.writer != nullptr) {
+            events |= EPOLLOUT;
+        }
+        if (events == handle.events) {
+            if (events == 0) {
+                handles.erase(fd);
+            }
+            return;
+        }
+        if (events == 0) {
+            epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+            handles.erase(fd);
+            return;
+        }
+        epoll_event event = {};
+        event.events = events;
+        event.data.fd = fd;
+        if (epoll_ctl(epoll, handle.events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event) != 0) {
+            throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+        }
+        handle.events = events;
+    }
+
+}
+
+#undef CALL_INFO
+#undef MAX_EVENTS
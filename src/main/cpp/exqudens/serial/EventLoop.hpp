@@ -0,0 +1,215 @@
+/*!
+* @file EventLoop.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/Task.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Single threaded epoll based loop that resumes coroutines suspended on native handles (Linux only).
+    *
+    * All coroutines spawned on a loop run on the thread that calls 'run',
+    * only 'stop' may be called from another thread.
+    */
+    class EXQUDENS_SERIAL_EXPORT EventLoop {
+
+        public:
+
+            /*!
+            * Awaitable readiness of a native handle, resumes with @b false when the deadline expires first.
+            */
+            class Wait {
+
+                friend class EventLoop;
+
+                private:
+
+                    EventLoop* loop = nullptr;
+                    int fd = -1;
+                    bool write = false;
+                    std::optional<std::chrono::steady_clock::time_point> deadline = {};
+                    std::coroutine_handle<> handle = nullptr;
+                    std::multimap<std::chrono::steady_clock::time_point, Wait*>::iterator deadlineEntry = {};
+                    bool subscribed = false;
+                    bool timedOut = false;
+
+                public:
+
+                    Wait(
+                        EventLoop* loop,
+                        const int& fd,
+                        const bool& write,
+                        const std::optional<std::chrono::steady_clock::time_point>& deadline
+                    ): loop(loop), fd(fd), write(write), deadline(deadline) {}
+
+                    Wait(const Wait&) = delete;
+
+                    Wait& operator=(const Wait&) = delete;
+
+                    bool await_ready() const noexcept {
+                        return false;
+                    }
+
+                    void await_suspend(std::coroutine_handle<> awaiting) {
+                        handle = awaiting;
+                        loop->subscribe(*this);
+                    }
+
+                    bool await_resume() const noexcept {
+                        return !timedOut;
+                    }
+
+                    ~Wait() {
+                        if (subscribed) {
+                            loop->unsubscribe(*this);
+                        }
+                    }
+
+            };
+
+        private:
+
+            struct Detached {
+
+                struct promise_type {
+
+                    Detached get_return_object() noexcept {
+                        return Detached {std::coroutine_handle<promise_type>::from_promise(*this)};
+                    }
+
+                    std::suspend_always initial_suspend() noexcept {
+                        return {};
+                    }
+
+                    std::suspend_never final_suspend() noexcept {
+                        return {};
+                    }
+
+                    void return_void() noexcept {}
+
+                    void unhandled_exception() noexcept {
+                        std::terminate();
+                    }
+
+                };
+
+                std::coroutine_handle<promise_type> handle = nullptr;
+
+            };
+
+            struct Handle {
+                Wait* reader = nullptr;
+                Wait* writer = nullptr;
+                unsigned int events = 0;
+            };
+
+            int epoll = -1;
+            int wakeup = -1;
+            std::atomic<bool> stopped = false;
+            std::map<int, Handle> handles;
+            std::multimap<std::chrono::steady_clock::time_point, Wait*> deadlines;
+            std::map<size_t, std::coroutine_handle<>> tasks;
+            std::vector<std::coroutine_handle<>> ready;
+            size_t nextTaskId = 1;
+            std::exception_ptr exception = nullptr;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            EventLoop();
+
+            EventLoop(const EventLoop&) = delete;
+
+            EventLoop& operator=(const EventLoop&) = delete;
+
+            /*!
+            * Schedules a task, it starts running on the next 'run' call.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void spawn(
+                Task<void> task //!< A task to run.
+            );
+
+            /*!
+            * Runs the loop on the calling thread until all spawned tasks are completed or 'stop' is called.
+            *
+            * @throws std::runtime_error with the first exception thrown by a spawned task nested.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void run();
+
+            /*!
+            * Makes the running or the next 'run' call return as soon as possible, may be called from any thread.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void stop();
+
+            /*!
+            * Gets number of spawned tasks that are not completed.
+            *
+            * @return A task count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getTaskCount() const;
+
+            /*!
+            * Creates an awaitable that resumes when the native handle is readable.
+            *
+            * @return An awaitable resuming with @b false on timeout.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Wait readable(
+                const int& fd,                                                                      //!< A non-blocking native handle.
+                const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt //!< A deadline, none to wait without limit.
+            );
+
+            /*!
+            * Creates an awaitable that resumes when the native handle is writable.
+            *
+            * @return An awaitable resuming with @b false on timeout.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Wait writable(
+                const int& fd,                                                                      //!< A non-blocking native handle.
+                const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt //!< A deadline, none to wait without limit.
+            );
+
+            /*!
+            * Destructor, destroys not completed tasks.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~EventLoop() noexcept;
+
+        private:
+
+            static Detached detach(EventLoop* loop, size_t id, Task<void> task);
+
+            void subscribe(Wait& wait);
+
+            void unsubscribe(Wait& wait);
+
+            void update(const int& fd, Handle& handle);
+
+    };
+
+}
@@ -0,0 +1,139 @@
+/*!
+* @file FrameChannel.cpp
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "exqudens/serial/FrameChannel.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+#include "exqudens/serial/Cobs.hpp"
+#include "exqudens/serial/Slip.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    FrameChannel::FrameChannel(
+        const std::shared_ptr<ISerial>& serial,
+        const Codec& codec,
+        const size_t& maxFrameSize
+    ):
+        serial(serial),
+        codec(codec),
+        maxFrameSize(maxFrameSize)
+    {
+        try {
+            if (!serial) {
+                throw std::invalid_argument("serial");
+            }
+            if (maxFrameSize == 0) {
+                throw std::invalid_argument("maxFrameSize");
+            }
+            if (codec == Codec::COBS) {
+                delimiter = std::byte(0);
+                writeBuffer.resize(Cobs::getMaxEncodedSize(maxFrameSize) + 1);
+            } else if (codec == Codec::SLIP) {
+                delimiter = Slip::END;
+                writeBuffer.resize(Slip::getMaxEncodedSize(maxFrameSize));
+            } else {
+                throw std::invalid_argument("codec");
+            }
+            readBuffer.resize(writeBuffer.size());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    FrameChannel::Codec FrameChannel::getCodec() const {
+        return codec;
+    }
+
+    size_t FrameChannel::send(std::span<const std::byte> payload) {
+        try {
+            if (payload.size() > maxFrameSize) {
+                throw std::length_error("payload size: " + std::to_string(payload.size()) + " greater than: " + std::to_string(maxFrameSize));
+            }
+            if (!payload.empty()) {
+                std::memcpy(writeBuffer.data(), payload.data(), payload.size());
+            }
+            size_t size = 0;
+            if (codec == Codec::COBS) {
+                size = Cobs::encode(writeBuffer, payload.size());
+                writeBuffer[size++] = delimiter;
+            } else {
+                size = Slip::encode(writeBuffer, payload.size());
+            }
+            return serial->writeFrom(std::span<const std::byte>(writeBuffer).first(size));
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t FrameChannel::receive(const std::function<void(std::span<const std::byte> frame)>& consumer) {
+        try {
+            if (readBufferBegin > 0) {
+                std::memmove(readBuffer.data(), readBuffer.data() + readBufferBegin, readBufferEnd - readBufferBegin);
+                readBufferEnd -= readBufferBegin;
+                readBufferScanned -= readBufferBegin;
+                readBufferBegin = 0;
+            }
+            readBufferEnd += serial->readInto(std::span<std::byte>(readBuffer).subspan(readBufferEnd));
+
+            size_t result = 0;
+            while (true) {
+                size_t index = readBufferScanned + ByteScanner::find(
+                    std::span<const std::byte>(readBuffer.data() + readBufferScanned, readBufferEnd - readBufferScanned),
+                    delimiter
+                );
+                if (index == readBufferEnd) {
+                    readBufferScanned = readBufferEnd;
+                    break;
+                }
+                std::span<std::byte> frame(readBuffer.data() + readBufferBegin, index - readBufferBegin);
+                readBufferBegin = index + 1;
+                readBufferScanned = readBufferBegin;
+                if (discarding) {
+                    discarding = false;
+                    continue;
+                }
+                if (frame.empty()) {
+                    continue;
+                }
+                size_t size = 0;
+                try {
+                    size = codec == Codec::COBS ? Cobs::decode(frame) : Slip::decode(frame);
+                } catch (const std::exception&) {
+                    droppedCount++;
+                    continue;
+                }
+                if (size > maxFrameSize) {
+                    droppedCount++;
+                    continue;
+                }
+                consumer(frame.first(size));
+                result++;
+            }
+
+            if (readBufferBegin == 0 && readBufferEnd == readBuffer.size()) {
+                droppedCount++;
+                discarding = true;
+                readBufferEnd = 0;
+                readBufferScanned = 0;
+            }
+
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t FrameChannel::getDroppedCount() const {
+        return droppedCount;
+    }
+
+}
+
+#undef CALL_INFO
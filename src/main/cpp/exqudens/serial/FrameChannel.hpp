@@ -0,0 +1,108 @@
+/*!
+* @file FrameChannel.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/ISerial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Sends and receives COBS or SLIP framed payloads over a port.
+    *
+    * Received bytes are collected in one preallocated buffer, frames are decoded in place there
+    * and passed to the consumer as views, so a frame is never copied after it was read.
+    */
+    class EXQUDENS_SERIAL_EXPORT FrameChannel {
+
+        public:
+
+            enum class Codec {
+                COBS,   //!< Zero byte delimited COBS frames.
+                SLIP    //!< 'END' delimited SLIP frames.
+            };
+
+        private:
+
+            std::shared_ptr<ISerial> serial = nullptr;
+            Codec codec = Codec::COBS;
+            std::byte delimiter = std::byte(0);
+            size_t maxFrameSize = 0;
+            std::vector<std::byte> readBuffer;
+            size_t readBufferBegin = 0;
+            size_t readBufferEnd = 0;
+            size_t readBufferScanned = 0;
+            bool discarding = false;
+            std::vector<std::byte> writeBuffer;
+            size_t droppedCount = 0;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            FrameChannel(
+                const std::shared_ptr<ISerial>& serial, //!< A port.
+                const Codec& codec,                     //!< A codec.
+                const size_t& maxFrameSize = 65536      //!< A maximal payload size in bytes, larger received frames are dropped.
+            );
+
+            FrameChannel(const FrameChannel&) = delete;
+
+            FrameChannel& operator=(const FrameChannel&) = delete;
+
+            /*!
+            * Gets codec.
+            *
+            * @return A codec.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Codec getCodec() const;
+
+            /*!
+            * Encodes and writes one frame.
+            *
+            * @return A number of encoded bytes written.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t send(
+                std::span<const std::byte> payload //!< A payload, at most 'maxFrameSize' bytes.
+            );
+
+            /*!
+            * Performs one read from the port and passes every complete frame to the consumer.
+            * Empty, malformed and oversized frames are dropped.
+            *
+            * @return A number of frames passed to the consumer.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t receive(
+                const std::function<void(std::span<const std::byte> frame)>& consumer //!< A consumer, the view is valid during the call only.
+            );
+
+            /*!
+            * Gets number of received frames dropped because they were malformed or oversized.
+            *
+            * @return A frame count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getDroppedCount() const;
+
+    };
+
+}
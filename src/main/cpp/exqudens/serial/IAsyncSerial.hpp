@@ -0,0 +1,70 @@
+/*!
+* @file IAsyncSerial.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/Task.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Coroutine based serial port i/o, the operations suspend the caller instead of blocking the thread.
+    */
+    class EXQUDENS_SERIAL_EXPORT IAsyncSerial {
+
+        public:
+
+            /*!
+            * Reads available bytes, suspends until at least one byte is received.
+            *
+            * @return A task resolved with the number of bytes read, 0 on timeout.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual Task<size_t> readAsync(
+                std::span<std::byte> bytes,     //!< A buffer to be filled.
+                const unsigned int& timeout     //!< A timeout in milliseconds, 0 to wait without limit.
+            ) = 0;
+
+            /*!
+            * Reads bytes up to and including the delimiter.
+            *
+            * @return A task resolved with a view of the bytes including the delimiter, a full read buffer without the delimiter
+            * if it was not found in it, empty on timeout. The view points into an internal buffer and is valid until the next read operation.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual Task<std::span<const std::byte>> readUntilAsync(
+                const std::byte& delimiter,     //!< A delimiter.
+                const unsigned int& timeout     //!< A timeout in milliseconds, 0 to wait without limit.
+            ) = 0;
+
+            /*!
+            * Writes all bytes, suspends while the port is not writable.
+            *
+            * @return A task resolved with the number of bytes written, less than 'bytes.size()' on timeout only.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual Task<size_t> writeAsync(
+                std::span<const std::byte> bytes,   //!< A bytes to be written.
+                const unsigned int& timeout         //!< A timeout in milliseconds, 0 to wait without limit.
+            ) = 0;
+
+            /*!
+            * Destructor.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual ~IAsyncSerial() noexcept = default;
+
+    };
+
+}
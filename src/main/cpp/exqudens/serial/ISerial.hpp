@@ -5,12 +5,19 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <span>
 #include <functional>
+#include <future>
+#include <regex>
+#include <system_error>
 
 #include "exqudens/serial/export.hpp"
+#include "exqudens/serial/PortList.hpp"
 
 namespace exqudens {
 
@@ -49,6 +56,24 @@ namespace exqudens {
             EXQUDENS_SERIAL_INLINE
             virtual bool isSetLogFunction() = 0;
 
+            /*!
+            * Sets log level threshold, records with a greater level are dropped before their message is formatted.
+            * Levels follow the log function: 1 fatal, 2 error, 3 warning, 4 info, 5 debug, 6 verbose.
+            * Records above the compile time limit 'EXQUDENS_SERIAL_LOG_LEVEL' (4 when 'NDEBUG' is defined, 6 otherwise) are never emitted.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void setLogLevel(
+                    const unsigned short& value //!< A log level threshold.
+            ) = 0;
+
+            /*!
+            * Gets log level threshold.
+            *
+            * @return A log level threshold.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual unsigned short getLogLevel() = 0;
+
             /*!
             * Gets library version.
             *
@@ -67,6 +92,43 @@ namespace exqudens {
             EXQUDENS_SERIAL_INLINE
             virtual std::vector<std::map<std::string, std::string>> listPorts() = 0;
 
+            /*!
+            * Lists the serial ports accepted by the predicate, filtering during enumeration.
+            *
+            * @return An accepted ports, a rejected port is never copied into the result.
+            *
+            * @throws std::runtime_error
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual PortList findPorts(
+                const PortList::Predicate& predicate = {} //!< A filter, empty accepts all ports.
+            ) = 0;
+
+            /*!
+            * Lists the serial ports of a USB device.
+            *
+            * @return A ports whose hardware id reports the vendor and product ids.
+            *
+            * @throws std::runtime_error
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual PortList findPorts(
+                const uint16_t& vendorId,   //!< A USB vendor id.
+                const uint16_t& productId   //!< A USB product id.
+            ) = 0;
+
+            /*!
+            * Lists the serial ports matching a pattern.
+            *
+            * @return A ports whose address, description or hardware id contains a match.
+            *
+            * @throws std::runtime_error
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual PortList findPorts(
+                const std::regex& pattern //!< A pattern searched in every field.
+            ) = 0;
+
             /*!
             * Opens the serial port connection with parameter(s).
             *
@@ -75,7 +137,7 @@ namespace exqudens {
             EXQUDENS_SERIAL_INLINE
             virtual void open(
                 const std::string& port,                                        //!< A string reference containing the address of the serial port, which would be something like 'COM1' on Windows and '/dev/ttyS0' on Linux.
-                const unsigned int& baudRate,                             //!< An integer that sets the baud rate for the serial port, default is 9600. Possible baud rates depends on the system but some safe baud rates include: 110, 300, 600, 1200, 2400, 4800, 9600, 14400, 19200, 28800, 38400, 56000, 57600, 115200. Some other baudrates that are supported by some comports: 128000, 153600, 230400, 256000, 460800, 921600.
+                const unsigned int& baudRate,                             //!< An integer that sets the baud rate for the serial port, default is 9600. Possible baud rates depends on the system but some safe baud rates include: 110, 300, 600, 1200, 2400, 4800, 9600, 14400, 19200, 28800, 38400, 56000, 57600, 115200. Some other baudrates that are supported by some comports: 128000, 153600, 230400, 256000, 460800, 921600. On Linux any rate the driver can produce, like 12000000, is applied through termios2.
                 const unsigned int& timeoutInterByte,             //!< Number of milliseconds between bytes received to timeout on.
                 const unsigned int& timeoutReadConstant,        //!< A constant number of milliseconds to wait after calling read.
                 const unsigned int& timeoutReadMultiplier,    //!< A multiplier against the number of requested bytes to wait after calling read.
@@ -87,6 +149,26 @@ namespace exqudens {
                 const unsigned int& flowControl                         //!< Type of flow control used, default is 0-none, possible values are: 0-none, 1-software, 2-hardware.
             ) = 0;
 
+            /*!
+            * Opens the serial port connection with parameter(s) without throwing.
+            * Same as the throwing variant, failures are reported through 'error' instead.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void open(
+                const std::string& port,                      //!< A port address, see the throwing variant.
+                const unsigned int& baudRate,                 //!< A baud rate, see the throwing variant.
+                const unsigned int& timeoutInterByte,         //!< Number of milliseconds between bytes received to timeout on.
+                const unsigned int& timeoutReadConstant,      //!< A constant number of milliseconds to wait after calling read.
+                const unsigned int& timeoutReadMultiplier,    //!< A multiplier against the number of requested bytes to wait after calling read.
+                const unsigned int& timeoutWriteConstant,     //!< A constant number of milliseconds to wait after calling write.
+                const unsigned int& timeoutWriteMultiplier,   //!< A multiplier against the number of requested bytes to wait after calling write.
+                const unsigned int& biteSize,                 //!< Size of each byte, possible values are: 5, 6, 7, 8.
+                const unsigned int& parity,                   //!< Method of parity, possible values are: 0-none, 1-odd, 2-even.
+                const unsigned int& stopBits,                 //!< Number of stop bits, possible values are: 0-one, 1-one-point-five, 2-two.
+                const unsigned int& flowControl,              //!< Type of flow control, possible values are: 0-none, 1-software, 2-hardware.
+                std::error_code& error                        //!< Set to the failure reason, cleared on success.
+            ) noexcept = 0;
+
             /*!
             * Opens the serial port connection with parameter(s).
             *
@@ -98,6 +180,16 @@ namespace exqudens {
                 const unsigned int& timeoutSimple //!< A value that defines the time in milliseconds until a timeout occurs after a call to read or write is made.
             ) = 0;
 
+            /*!
+            * Opens the serial port connection with parameter(s) without throwing.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void open(
+                const std::string& port,            //!< A port address, see the throwing variant.
+                const unsigned int& timeoutSimple,  //!< A read and write timeout in milliseconds.
+                std::error_code& error              //!< Set to the failure reason, cleared on success.
+            ) noexcept = 0;
+
             /*!
             * Opens the serial port connection with parameter(s).
             *
@@ -116,12 +208,92 @@ namespace exqudens {
             EXQUDENS_SERIAL_INLINE
             virtual bool isOpen() = 0;
 
+            /*!
+            * Changes the baud rate of the open port in place, buffered data and running reader and writer threads are kept.
+            * Does nothing if the rate is unchanged.
+            * A non-standard rate the driver does not apply exactly is rejected like in 'open' and the previous rate is kept.
+            *
+            * @return A baud rate applied by the driver.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual unsigned int setBaudRate(
+                const unsigned int& baudRate //!< A baud rate, see 'open'.
+            ) = 0;
+
+            /*!
+            * Gets the baud rate of the open port, on Linux as reported by the driver.
+            *
+            * @return A baud rate.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual unsigned int getBaudRate() = 0;
+
+            /*!
+            * Tries the candidate baud rates on the open port and restores the current one afterwards.
+            *
+            * @return A baud rates applied for the candidates in the same order, @b 0 for a rejected candidate.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual std::vector<unsigned int> getAchievableBaudRates(
+                const std::vector<unsigned int>& candidates //!< A requested baud rates.
+            ) = 0;
+
+            /*!
+            * Changes the timeouts of the open port in place, does nothing if they are unchanged.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void setTimeouts(
+                const unsigned int& timeoutInterByte,         //!< Number of milliseconds between bytes received to timeout on.
+                const unsigned int& timeoutReadConstant,      //!< A constant number of milliseconds to wait after calling read.
+                const unsigned int& timeoutReadMultiplier,    //!< A multiplier against the number of requested bytes to wait after calling read.
+                const unsigned int& timeoutWriteConstant,     //!< A constant number of milliseconds to wait after calling write.
+                const unsigned int& timeoutWriteMultiplier    //!< A multiplier against the number of requested bytes to wait after calling write.
+            ) = 0;
+
+            /*!
+            * Changes the character framing of the open port in place, only the changed fields are applied.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void setFraming(
+                const unsigned int& biteSize,   //!< Size of each byte, possible values are: 5, 6, 7, 8.
+                const unsigned int& parity,     //!< Method of parity, possible values are: 0-none, 1-odd, 2-even.
+                const unsigned int& stopBits    //!< Number of stop bits, possible values are: 0-one, 1-one-point-five, 2-two.
+            ) = 0;
+
+            /*!
+            * Changes the flow control of the open port in place, does nothing if it is unchanged.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void setFlowControl(
+                const unsigned int& flowControl //!< Type of flow control, possible values are: 0-none, 1-software, 2-hardware.
+            ) = 0;
+
             /*!
             * Closes the serial port.
             */
             EXQUDENS_SERIAL_INLINE
             virtual void close() = 0;
 
+            /*!
+            * Closes the serial port without throwing.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void close(
+                std::error_code& error //!< Set to the failure reason, cleared on success.
+            ) noexcept = 0;
+
             /*!
             * Write a bytes to the serial port.
             *
@@ -146,6 +318,182 @@ namespace exqudens {
                 const size_t& size //!< A size defining how many bytes to be read.
             ) = 0;
 
+            /*!
+            * Write a bytes from the caller buffer to the serial port without intermediate copies.
+            *
+            * @return A size representing the number of bytes actually written to the serial port.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t writeFrom(
+                std::span<const std::byte> bytes //!< A view of the data to be written to the serial port.
+            ) = 0;
+
+            /*!
+            * Write a bytes from the caller buffer to the serial port without throwing.
+            * A write timeout is not an error, it is reported by a short count.
+            *
+            * @return A size representing the number of bytes actually written before the error if any.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t writeFrom(
+                std::span<const std::byte> bytes, //!< A view of the data to be written to the serial port.
+                std::error_code& error            //!< Set to the failure reason, cleared on success.
+            ) noexcept = 0;
+
+            /*!
+            * Write a several buffers to the serial port in order (gather write) without joining them first.
+            *
+            * @return A size representing the total number of bytes actually written to the serial port,
+            * writing stops at the first buffer that was not written completely.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t writeFrom(
+                std::span<const std::span<const std::byte>> buffers //!< A views of the data to be written to the serial port.
+            ) = 0;
+
+            /*!
+            * Read bytes from the serial port directly into the caller buffer.
+            *
+            * @return A size representing the number of bytes actually read, at most 'bytes.size()'.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t readInto(
+                std::span<std::byte> bytes //!< A buffer to be filled, its size defines how many bytes to be read.
+            ) = 0;
+
+            /*!
+            * Read bytes from the serial port directly into the caller buffer without throwing.
+            * A read timeout is not an error, it is reported by a short count.
+            *
+            * @return A size representing the number of bytes actually read, @b 0 on error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t readInto(
+                std::span<std::byte> bytes, //!< A buffer to be filled, its size defines how many bytes to be read.
+                std::error_code& error      //!< Set to the failure reason, cleared on success.
+            ) noexcept = 0;
+
+            /*!
+            * Read bytes from the serial port up to and including the delimiter through an internal buffer.
+            * Bytes received after the delimiter stay buffered and are returned first by the next read call.
+            *
+            * @return A view of the bytes including the delimiter, 'maxSize' bytes without the delimiter if it was not found in them,
+            * empty if no more bytes arrived within the read timeout. The view is valid until the next read call.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual std::span<const std::byte> readUntil(
+                const std::byte& delimiter,   //!< A delimiter.
+                const size_t& maxSize = 65536 //!< A maximal number of bytes to be returned.
+            ) = 0;
+
+            /*!
+            * Read a line terminated by '\n', see 'readUntil'.
+            *
+            * @return A view of the line including the terminator, empty if no more bytes arrived within the read timeout.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual std::string_view readLine(
+                const size_t& maxSize = 65536 //!< A maximal number of bytes to be returned.
+            ) = 0;
+
+            /*!
+            * Starts a dedicated reader thread that drains the serial port into a preallocated lock-free buffer.
+            * While the reader is running 'readInto' and 'readBytes' return immediately with the buffered bytes
+            * (at most the requested size) without calling into the system.
+            * Bytes received while the buffer is full are dropped and counted as overflow.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void startReader(
+                const size_t& capacity //!< A buffer capacity in bytes, rounded up to the next power of two.
+            ) = 0;
+
+            /*!
+            * Stops the reader thread, bytes already buffered remain readable.
+            * Blocks for at most one read timeout of the open port.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void stopReader() = 0;
+
+            /*!
+            * Gets the reader thread status.
+            *
+            * @return Returns @b true if the reader thread is running, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual bool isReaderRunning() = 0;
+
+            /*!
+            * Gets number of bytes dropped by the reader thread because the buffer was full.
+            *
+            * @return An overflow count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t getReaderOverflowCount() = 0;
+
+            /*!
+            * Gets maximal number of bytes ever buffered by the reader thread at once.
+            *
+            * @return A high-water mark.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual size_t getReaderHighWaterMark() = 0;
+
+            /*!
+            * Starts a dedicated writer thread that coalesces messages queued by 'writeAsync' into large writes.
+            * A batch is written as soon as 'flushBytes' are pending or the oldest pending message waited 'flushDelay'.
+            * Synchronous 'writeBytes' and 'writeFrom' remain available, their ordering relative to queued messages is not defined.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void startWriter(
+                const size_t& queueCapacity,    //!< A maximal number of queued messages, 'writeAsync' blocks while the queue is full.
+                const size_t& flushBytes,       //!< A number of pending bytes that triggers a write, also the size of the coalescing buffer.
+                const unsigned int& flushDelay  //!< A maximal number of microseconds a queued message waits for coalescing.
+            ) = 0;
+
+            /*!
+            * Stops the writer thread after writing all queued messages.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual void stopWriter() = 0;
+
+            /*!
+            * Gets the writer thread status.
+            *
+            * @return Returns @b true if the writer thread is running, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual bool isWriterRunning() = 0;
+
+            /*!
+            * Queues a bytes for the writer thread.
+            *
+            * @return A future resolved with the number of bytes of this message actually written to the serial port.
+            *
+            * @throws std::runtime_error if the writer thread is not running.
+            */
+            EXQUDENS_SERIAL_INLINE
+            virtual std::future<size_t> writeAsync(
+                std::vector<unsigned char> bytes //!< A data to be written, moved into the queue.
+            ) = 0;
+
             /*!
             * Destructor.
             */
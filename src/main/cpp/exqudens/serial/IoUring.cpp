@@ -0,0 +1,339 @@
+/*!
+* @file IoUring.cpp
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <atomic>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "exqudens/serial/IoUring.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define USER_DATA_TRANSFER 1
+#define USER_DATA_TIMEOUT 2
+
+namespace exqudens {
+
+    bool IoUring::isSupported() {
+        static const bool supported = [] {
+            io_uring_params params = {};
+            int value = static_cast<int>(syscall(__NR_io_uring_setup, 1, &params));
+            if (value < 0) {
+                return false;
+            }
+            ::close(value);
+            return true;
+        }();
+        return supported;
+    }
+
+    IoUring::IoUring(const unsigned int& entries) {
+        try {
+            io_uring_params params = {};
+            fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+            }
+
+            sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+            cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMmap) {
+                sqRingSize = std::max(sqRingSize, cqRingSize);
+                cqRingSize = sqRingSize;
+            }
+
+            sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            if (sqRing == MAP_FAILED) {
+                sqRing = nullptr;
+                throw std::system_error(errno, std::generic_category(), "mmap sq ring");
+            }
+            if (singleMmap) {
+                cqRing = sqRing;
+            } else {
+                cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+                if (cqRing == MAP_FAILED) {
+                    cqRing = nullptr;
+                    throw std::system_error(errno, std::generic_category(), "mmap cq ring");
+                }
+            }
+            sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) {
+                sqes = nullptr;
+                throw std::system_error(errno, std::generic_category(), "mmap sqes");
+            }
+
+            std::byte* sq = static_cast<std::byte*>(sqRing);
+            std::byte* cq = static_cast<std::byte*>(cqRing);
+            sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+            sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+            sqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+            sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+            cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+            cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+            cqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+            cqes = cq + params.cq_off.cqes;
+            sqEntries = params.sq_entries;
+        } catch (...) {
+            release();
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void IoUring::registerBuffers(std::span<const std::span<std::byte>> buffers) {
+        try {
+            std::vector<iovec> vectors;
+            vectors.reserve(buffers.size());
+            for (const std::span<std::byte>& buffer : buffers) {
+                vectors.emplace_back(iovec {buffer.data(), buffer.size()});
+            }
+            if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, vectors.data(), static_cast<unsigned int>(vectors.size())) < 0) {
+                throw std::system_error(errno, std::generic_category(), "io_uring_register");
+            }
+            buffersRegistered = true;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void IoUring::unregisterBuffers() {
+        try {
+            if (!buffersRegistered) {
+                return;
+            }
+            if (syscall(__NR_io_uring_register, fd, IORING_UNREGISTER_BUFFERS, nullptr, 0) < 0) {
+                throw std::system_error(errno, std::generic_category(), "io_uring_register");
+            }
+            buffersRegistered = false;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool IoUring::prepareRead(const int& handle, std::span<std::byte> bytes, const uint64_t& userData) {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = handle;
+        sqe->addr = reinterpret_cast<uint64_t>(bytes.data());
+        sqe->len = static_cast<uint32_t>(bytes.size());
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->user_data = userData;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+        return true;
+    }
+
+    bool IoUring::prepareWrite(const int& handle, std::span<const std::byte> bytes, const uint64_t& userData) {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = handle;
+        sqe->addr = reinterpret_cast<uint64_t>(bytes.data());
+        sqe->len = static_cast<uint32_t>(bytes.size());
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->user_data = userData;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+        return true;
+    }
+
+    bool IoUring::prepareReadFixed(const int& handle, std::span<std::byte> bytes, const unsigned short& bufferIndex, const uint64_t& userData) {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->fd = handle;
+        sqe->addr = reinterpret_cast<uint64_t>(bytes.data());
+        sqe->len = static_cast<uint32_t>(bytes.size());
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->buf_index = bufferIndex;
+        sqe->user_data = userData;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+        return true;
+    }
+
+    bool IoUring::prepareWriteFixed(const int& handle, std::span<const std::byte> bytes, const unsigned short& bufferIndex, const uint64_t& userData) {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode = IORING_OP_WRITE_FIXED;
+        sqe->fd = handle;
+        sqe->addr = reinterpret_cast<uint64_t>(bytes.data());
+        sqe->len = static_cast<uint32_t>(bytes.size());
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->buf_index = bufferIndex;
+        sqe->user_data = userData;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+        return true;
+    }
+
+    size_t IoUring::submit(const unsigned int& waitCount) {
+        try {
+            while (true) {
+                long value = syscall(__NR_io_uring_enter, fd, prepared, waitCount, waitCount > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+                if (value >= 0) {
+                    prepared -= static_cast<unsigned int>(value);
+                    return static_cast<size_t>(value);
+                }
+                if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t IoUring::reap(std::span<Completion> completions) {
+        unsigned int head = *cqHead;
+        unsigned int tail = std::atomic_ref<unsigned int>(*cqTail).load(std::memory_order_acquire);
+        size_t result = 0;
+        while (head != tail && result < completions.size()) {
+            const io_uring_cqe& cqe = static_cast<const io_uring_cqe*>(cqes)[head & *cqMask];
+            completions[result].userData = cqe.user_data;
+            completions[result].result = cqe.res;
+            result++;
+            head++;
+        }
+        std::atomic_ref<unsigned int>(*cqHead).store(head, std::memory_order_release);
+        return result;
+    }
+
+    size_t IoUring::read(const int& handle, std::span<std::byte> bytes, const std::chrono::nanoseconds& timeout) {
+        try {
+            return transfer(IORING_OP_READ, handle, bytes.data(), bytes.size(), timeout);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t IoUring::write(const int& handle, std::span<const std::byte> bytes, const std::chrono::nanoseconds& timeout) {
+        try {
+            return transfer(IORING_OP_WRITE, handle, const_cast<std::byte*>(bytes.data()), bytes.size(), timeout);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    IoUring::~IoUring() noexcept {
+        release();
+    }
+
+    void IoUring::release() {
+        if (sqes != nullptr) {
+            munmap(sqes, sqesSize);
+            sqes = nullptr;
+        }
+        if (cqRing != nullptr && cqRing != sqRing) {
+            munmap(cqRing, cqRingSize);
+        }
+        cqRing = nullptr;
+        if (sqRing != nullptr) {
+            munmap(sqRing, sqRingSize);
+            sqRing = nullptr;
+        }
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    void* IoUring::nextSqe() {
+        unsigned int head = std::atomic_ref<unsigned int>(*sqHead).load(std::memory_order_acquire);
+        unsigned int tail = *sqTail;
+        if (tail - head >= sqEntries) {
+            return nullptr;
+        }
+        unsigned int index = tail & *sqMask;
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes) + index;
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sqArray[index] = index;
+        return sqe;
+    }
+
+    size_t IoUring::transfer(const unsigned char& opcode, const int& handle, void* data, const size_t& size, const std::chrono::nanoseconds& timeout) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (prepared != 0) {
+            throw std::logic_error("prepared operations are not submitted");
+        }
+        if (sqEntries < 2) {
+            throw std::logic_error("ring is too small");
+        }
+
+        __kernel_timespec time = {};
+        time.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(timeout).count();
+        time.tv_nsec = (timeout - std::chrono::seconds(time.tv_sec)).count();
+
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(nextSqe());
+        sqe->opcode = opcode;
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->fd = handle;
+        sqe->addr = reinterpret_cast<uint64_t>(data);
+        sqe->len = static_cast<uint32_t>(size);
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->user_data = USER_DATA_TRANSFER;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+
+        sqe = static_cast<io_uring_sqe*>(nextSqe());
+        sqe->opcode = IORING_OP_LINK_TIMEOUT;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<uint64_t>(&time);
+        sqe->len = 1;
+        sqe->user_data = USER_DATA_TIMEOUT;
+        std::atomic_ref<unsigned int>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+        prepared++;
+
+        submit(2);
+
+        Completion completions[2] = {};
+        size_t count = 0;
+        while (count < 2) {
+            count += reap(std::span<Completion>(completions).subspan(count));
+            if (count < 2) {
+                submit(1);
+            }
+        }
+        for (const Completion& completion : completions) {
+            if (completion.userData != USER_DATA_TRANSFER) {
+                continue;
+            }
+            if (completion.result >= 0) {
+                return static_cast<size_t>(completion.result);
+            }
+            if (completion.result == -ECANCELED || completion.result == -EINTR) {
+                return 0;
+            }
+            throw std::system_error(-completion.result, std::generic_category(), "io_uring transfer");
+        }
+        return 0;
+    }
+
+}
+
+#undef CALL_INFO
+#undef USER_DATA_TRANSFER
+#undef USER_DATA_TIMEOUT
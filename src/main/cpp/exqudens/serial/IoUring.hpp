@@ -0,0 +1,212 @@
+/*!
+* @file IoUring.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <mutex>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Minimal io_uring submission/completion ring for batched reads and writes on native handles (Linux only).
+    *
+    * The prepare/submit/reap functions are not synchronized, one thread should drive a ring at a time.
+    * The 'read' and 'write' convenience functions are synchronized and must not be mixed with batches in flight.
+    */
+    class EXQUDENS_SERIAL_EXPORT IoUring {
+
+        public:
+
+            struct Completion {
+                uint64_t userData = 0;  //!< A value passed to the prepare function.
+                int result = 0;         //!< A number of bytes transferred or a negated errno value.
+            };
+
+        private:
+
+            int fd = -1;
+            void* sqRing = nullptr;
+            size_t sqRingSize = 0;
+            void* cqRing = nullptr;
+            size_t cqRingSize = 0;
+            void* sqes = nullptr;
+            size_t sqesSize = 0;
+            unsigned int* sqHead = nullptr;
+            unsigned int* sqTail = nullptr;
+            unsigned int* sqMask = nullptr;
+            unsigned int* sqArray = nullptr;
+            unsigned int* cqHead = nullptr;
+            unsigned int* cqTail = nullptr;
+            unsigned int* cqMask = nullptr;
+            void* cqes = nullptr;
+            unsigned int sqEntries = 0;
+            unsigned int prepared = 0;
+            bool buffersRegistered = false;
+            std::mutex mutex;
+
+        public:
+
+            /*!
+            * Checks if the running kernel supports io_uring.
+            *
+            * @return @b true if a ring can be created, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static bool isSupported();
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error if the kernel does not support io_uring.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit IoUring(
+                const unsigned int& entries = 256 //!< A submission queue size, rounded up to a power of two by the kernel.
+            );
+
+            IoUring(const IoUring&) = delete;
+
+            IoUring& operator=(const IoUring&) = delete;
+
+            /*!
+            * Registers buffers for fixed reads and writes so the kernel does not map them on every operation.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void registerBuffers(
+                std::span<const std::span<std::byte>> buffers //!< A buffers, addressed by index in fixed operations.
+            );
+
+            /*!
+            * Unregisters buffers registered by 'registerBuffers'.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void unregisterBuffers();
+
+            /*!
+            * Queues a read without submitting it.
+            *
+            * @return @b false if the submission queue is full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool prepareRead(
+                const int& handle,              //!< A native handle.
+                std::span<std::byte> bytes,     //!< A buffer to be filled, must stay valid until completion.
+                const uint64_t& userData        //!< A value returned with the completion.
+            );
+
+            /*!
+            * Queues a write without submitting it.
+            *
+            * @return @b false if the submission queue is full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool prepareWrite(
+                const int& handle,                  //!< A native handle.
+                std::span<const std::byte> bytes,   //!< A data to be written, must stay valid until completion.
+                const uint64_t& userData            //!< A value returned with the completion.
+            );
+
+            /*!
+            * Queues a read into a registered buffer without submitting it.
+            *
+            * @return @b false if the submission queue is full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool prepareReadFixed(
+                const int& handle,                  //!< A native handle.
+                std::span<std::byte> bytes,         //!< A part of the registered buffer to be filled.
+                const unsigned short& bufferIndex,  //!< A registered buffer index.
+                const uint64_t& userData            //!< A value returned with the completion.
+            );
+
+            /*!
+            * Queues a write from a registered buffer without submitting it.
+            *
+            * @return @b false if the submission queue is full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool prepareWriteFixed(
+                const int& handle,                  //!< A native handle.
+                std::span<const std::byte> bytes,   //!< A part of the registered buffer to be written.
+                const unsigned short& bufferIndex,  //!< A registered buffer index.
+                const uint64_t& userData            //!< A value returned with the completion.
+            );
+
+            /*!
+            * Submits all prepared operations with one system call.
+            *
+            * @return A number of submitted operations.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t submit(
+                const unsigned int& waitCount = 0 //!< A number of completions to wait for.
+            );
+
+            /*!
+            * Copies available completions without a system call.
+            *
+            * @return A number of completions copied.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t reap(
+                std::span<Completion> completions //!< A buffer to be filled.
+            );
+
+            /*!
+            * Reads from a handle waiting until at least one byte is available or the timeout expires.
+            *
+            * @return A number of bytes read, zero on timeout.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t read(
+                const int& handle,                          //!< A native handle.
+                std::span<std::byte> bytes,                 //!< A buffer to be filled.
+                const std::chrono::nanoseconds& timeout     //!< A timeout.
+            );
+
+            /*!
+            * Writes to a handle waiting until at least one byte is written or the timeout expires.
+            *
+            * @return A number of bytes written, zero on timeout.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t write(
+                const int& handle,                          //!< A native handle.
+                std::span<const std::byte> bytes,           //!< A data to be written.
+                const std::chrono::nanoseconds& timeout     //!< A timeout.
+            );
+
+            /*!
+            * Destructor.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~IoUring() noexcept;
+
+        private:
+
+            void release();
+
+            void* nextSqe();
+
+            size_t transfer(const unsigned char& opcode, const int& handle, void* data, const size_t& size, const std::chrono::nanoseconds& timeout);
+
+    };
+
+}
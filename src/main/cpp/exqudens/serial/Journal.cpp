@@ -0,0 +1,192 @@
+/*!
+* @file Journal.cpp
+*/
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "exqudens/serial/Journal.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define JOURNAL_MAGIC "EXQJRNL1"
+#define FILE_HEADER_SIZE 16
+#define RECORD_HEADER_SIZE 16
+#define RECORD_ALIGNMENT 8
+
+namespace exqudens {
+
+    namespace {
+
+        // 'size' is the commit word, zero until the payload is in place.
+        struct RecordHeader {
+            uint32_t size;
+            uint8_t direction;
+            uint8_t reserved[3];
+            int64_t time;
+        };
+
+        static_assert(sizeof(RecordHeader) == RECORD_HEADER_SIZE);
+
+        size_t getRecordSize(const size_t& payloadSize) {
+            return (RECORD_HEADER_SIZE + payloadSize + RECORD_ALIGNMENT - 1) & ~static_cast<size_t>(RECORD_ALIGNMENT - 1);
+        }
+
+    }
+
+    Journal::Journal(const std::string& path, const size_t& capacity): capacity(capacity) {
+        try {
+            if (capacity < FILE_HEADER_SIZE + RECORD_HEADER_SIZE) {
+                throw std::invalid_argument("capacity");
+            }
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "open");
+            }
+            // Allocated up front, a write into a hole of a full file system would raise SIGBUS on the I/O path.
+            int allocated = posix_fallocate(fd, 0, static_cast<off_t>(capacity));
+            if (allocated != 0) {
+                ::close(fd);
+                throw std::system_error(allocated, std::generic_category(), "posix_fallocate");
+            }
+            void* value = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+            if (value == MAP_FAILED) {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "mmap");
+            }
+            data = static_cast<std::byte*>(value);
+            std::memcpy(data, JOURNAL_MAGIC, FILE_HEADER_SIZE / 2);
+            tail.store(FILE_HEADER_SIZE, std::memory_order_relaxed);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool Journal::append(const Direction& direction, std::span<const std::byte> bytes) noexcept {
+        if (bytes.empty()) {
+            return true;
+        }
+        int64_t time = std::chrono::steady_clock::now().time_since_epoch().count();
+        size_t size = getRecordSize(bytes.size());
+        size_t offset = tail.load(std::memory_order_relaxed);
+        do {
+            if (bytes.size() > UINT32_MAX || offset + size > capacity) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } while (!tail.compare_exchange_weak(offset, offset + size, std::memory_order_relaxed));
+
+        RecordHeader* header = reinterpret_cast<RecordHeader*>(data + offset);
+        header->direction = static_cast<uint8_t>(direction);
+        header->time = time;
+        std::memcpy(data + offset + RECORD_HEADER_SIZE, bytes.data(), bytes.size());
+        std::atomic_ref<uint32_t>(header->size).store(static_cast<uint32_t>(bytes.size()), std::memory_order_release);
+        return true;
+    }
+
+    size_t Journal::getSize() const {
+        return tail.load(std::memory_order_relaxed);
+    }
+
+    size_t Journal::getCapacity() const {
+        return capacity;
+    }
+
+    size_t Journal::getDroppedCount() const {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    void Journal::flush() {
+        try {
+            if (msync(data, getSize(), MS_SYNC) != 0) {
+                throw std::system_error(errno, std::generic_category(), "msync");
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Journal::read(const std::string& path, const std::function<void(const Record&)>& consumer) {
+        int handle = -1;
+        void* value = MAP_FAILED;
+        size_t size = 0;
+        try {
+            handle = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (handle < 0) {
+                throw std::system_error(errno, std::generic_category(), "open");
+            }
+            struct stat status = {};
+            if (fstat(handle, &status) != 0) {
+                throw std::system_error(errno, std::generic_category(), "fstat");
+            }
+            size = static_cast<size_t>(status.st_size);
+            if (size < FILE_HEADER_SIZE) {
+                throw std::runtime_error("not a journal segment");
+            }
+            value = mmap(nullptr, size, PROT_READ, MAP_SHARED, handle, 0);
+            if (value == MAP_FAILED) {
+                throw std::system_error(errno, std::generic_category(), "mmap");
+            }
+            const std::byte* bytes = static_cast<const std::byte*>(value);
+            if (std::memcmp(bytes, JOURNAL_MAGIC, FILE_HEADER_SIZE / 2) != 0) {
+                throw std::runtime_error("not a journal segment");
+            }
+
+            size_t result = 0;
+            size_t offset = FILE_HEADER_SIZE;
+            while (offset + RECORD_HEADER_SIZE <= size) {
+                RecordHeader header = {};
+                std::memcpy(&header, bytes + offset, RECORD_HEADER_SIZE);
+                if (header.size == 0 || offset + getRecordSize(header.size) > size) {
+                    break;
+                }
+                consumer(Record {
+                    .time = std::chrono::nanoseconds(header.time),
+                    .direction = static_cast<Direction>(header.direction),
+                    .bytes = std::span<const std::byte>(bytes + offset + RECORD_HEADER_SIZE, header.size)
+                });
+                offset += getRecordSize(header.size);
+                result++;
+            }
+
+            munmap(value, size);
+            ::close(handle);
+            return result;
+        } catch (...) {
+            if (value != MAP_FAILED) {
+                munmap(value, size);
+            }
+            if (handle >= 0) {
+                ::close(handle);
+            }
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    Journal::~Journal() noexcept {
+        if (data != nullptr) {
+            munmap(data, capacity);
+        }
+        if (fd >= 0) {
+            // Best effort, an untrimmed file keeps zeros after the last record where 'read' stops.
+            int ignored = ftruncate(fd, static_cast<off_t>(getSize()));
+            (void) ignored;
+            ::close(fd);
+        }
+    }
+
+}
+
+#undef CALL_INFO
+#undef JOURNAL_MAGIC
+#undef FILE_HEADER_SIZE
+#undef RECORD_HEADER_SIZE
+#undef RECORD_ALIGNMENT
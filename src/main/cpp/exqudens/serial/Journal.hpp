@@ -0,0 +1,130 @@
+/*!
+* @file Journal.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <string>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Append-only memory mapped segment file of timestamped traffic records (Linux only).
+    *
+    * Any number of threads may 'append' concurrently, space is reserved with a compare-and-swap on the tail
+    * and a record becomes visible to readers once its header is committed, no lock is taken on the I/O path.
+    * A segment has a fixed capacity, records that do not fit are dropped and counted.
+    */
+    class EXQUDENS_SERIAL_EXPORT Journal {
+
+        public:
+
+            enum class Direction : uint8_t {
+                READ = 0,   //!< Bytes received from the port.
+                WRITE = 1   //!< Bytes sent to the port.
+            };
+
+            struct Record {
+                std::chrono::nanoseconds time = std::chrono::nanoseconds(0);    //!< A steady clock time since its epoch.
+                Direction direction = Direction::READ;                          //!< A direction.
+                std::span<const std::byte> bytes = {};                          //!< A payload, valid during the consumer call.
+            };
+
+        private:
+
+            int fd = -1;
+            std::byte* data = nullptr;
+            size_t capacity = 0;
+            std::atomic<size_t> tail = 0;
+            std::atomic<size_t> droppedCount = 0;
+
+        public:
+
+            /*!
+            * Constructor, creates or truncates the segment file and maps it.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Journal(
+                const std::string& path,    //!< A segment file path.
+                const size_t& capacity      //!< A segment size in bytes including the file header.
+            );
+
+            Journal(const Journal&) = delete;
+
+            Journal& operator=(const Journal&) = delete;
+
+            /*!
+            * Appends a record stamped with the current steady clock time.
+            *
+            * @return @b false if the record did not fit and was dropped.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool append(
+                const Direction& direction,         //!< A direction.
+                std::span<const std::byte> bytes    //!< A payload, empty payloads are ignored.
+            ) noexcept;
+
+            /*!
+            * Gets the number of bytes used by the file header and appended records.
+            *
+            * @return A number of bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getSize() const;
+
+            /*!
+            * Gets the segment size.
+            *
+            * @return A number of bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getCapacity() const;
+
+            /*!
+            * Gets the number of records dropped because the segment was full.
+            *
+            * @return A number of records.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getDroppedCount() const;
+
+            /*!
+            * Writes the committed records to the file.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void flush();
+
+            /*!
+            * Reads the committed records of a segment file in append order.
+            *
+            * @return A number of records read.
+            *
+            * @throws std::runtime_error if the file is not a journal segment.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t read(
+                const std::string& path,                                //!< A segment file path.
+                const std::function<void(const Record&)>& consumer      //!< A record consumer.
+            );
+
+            /*!
+            * Destructor, trims the segment file to the used size.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~Journal() noexcept;
+
+    };
+
+}
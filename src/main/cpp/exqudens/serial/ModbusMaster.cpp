@@ -0,0 +1,345 @@
+/*!
+* @file ModbusMaster.cpp
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "exqudens/serial/ModbusMaster.hpp"
+#include "exqudens/serial/Crc.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define MAX_READ_COUNT 125
+#define MAX_WRITE_COUNT 123
+#define MAX_FRAME_SIZE 256
+
+namespace exqudens {
+
+    ModbusMaster::ModbusMaster(
+        const std::shared_ptr<ISerial>& serial,
+        const unsigned int& baudRate,
+        const unsigned int& characterBits,
+        const std::chrono::milliseconds& responseTimeout
+    ):
+        serial(serial),
+        responseTimeout(responseTimeout)
+    {
+        try {
+            if (!serial) {
+                throw std::invalid_argument("serial");
+            }
+            if (baudRate == 0) {
+                throw std::invalid_argument("baudRate");
+            }
+            if (characterBits == 0) {
+                throw std::invalid_argument("characterBits");
+            }
+            if (responseTimeout.count() <= 0) {
+                throw std::invalid_argument("responseTimeout");
+            }
+            if (baudRate > 19200) {
+                characterGap = std::chrono::microseconds(750);
+                frameGap = std::chrono::microseconds(1750);
+            } else {
+                characterGap = std::chrono::nanoseconds(1000000000ull * characterBits * 3 / (2ull * baudRate));
+                frameGap = std::chrono::nanoseconds(1000000000ull * characterBits * 7 / (2ull * baudRate));
+            }
+            requestBuffer.resize(MAX_FRAME_SIZE);
+            responseBuffer.resize(MAX_FRAME_SIZE);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::chrono::nanoseconds ModbusMaster::getCharacterGap() const {
+        return characterGap;
+    }
+
+    std::chrono::nanoseconds ModbusMaster::getFrameGap() const {
+        return frameGap;
+    }
+
+    std::vector<uint16_t> ModbusMaster::readHoldingRegisters(const uint8_t& slave, const uint16_t& address, const uint16_t& count) {
+        try {
+            return readRegisters(slave, 3, address, count);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::map<uint16_t, uint16_t> ModbusMaster::readHoldingRegisters(const uint8_t& slave, const std::vector<uint16_t>& addresses, const uint16_t& maxGap) {
+        try {
+            std::vector<uint16_t> sorted = addresses;
+            std::ranges::sort(sorted);
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+            std::map<uint16_t, uint16_t> result;
+            size_t i = 0;
+            while (i < sorted.size()) {
+                size_t j = i;
+                while (
+                    j + 1 < sorted.size()
+                    && static_cast<size_t>(sorted[j + 1] - sorted[j]) <= static_cast<size_t>(maxGap) + 1
+                    && static_cast<size_t>(sorted[j + 1] - sorted[i]) < MAX_READ_COUNT
+                ) {
+                    j++;
+                }
+                std::vector<uint16_t> values = readRegisters(slave, 3, sorted[i], static_cast<uint16_t>(sorted[j] - sorted[i] + 1));
+                for (size_t k = i; k <= j; k++) {
+                    result[sorted[k]] = values.at(sorted[k] - sorted[i]);
+                }
+                i = j + 1;
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<uint16_t> ModbusMaster::readInputRegisters(const uint8_t& slave, const uint16_t& address, const uint16_t& count) {
+        try {
+            return readRegisters(slave, 4, address, count);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void ModbusMaster::writeSingleRegister(const uint8_t& slave, const uint16_t& address, const uint16_t& value) {
+        try {
+            if (slave == 0 || slave > 247) {
+                throw std::invalid_argument("slave");
+            }
+            std::byte* output = requestBuffer.data();
+            output[0] = static_cast<std::byte>(slave);
+            output[1] = std::byte(6);
+            output[2] = static_cast<std::byte>(address >> 8);
+            output[3] = static_cast<std::byte>(address & 0xFF);
+            output[4] = static_cast<std::byte>(value >> 8);
+            output[5] = static_cast<std::byte>(value & 0xFF);
+            appendCrc(output, 6);
+            Status status = transact(std::span<const std::byte>(output, 8), 8);
+            check(status, slave, static_cast<uint8_t>(responseBuffer[2]));
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void ModbusMaster::writeMultipleRegisters(const uint8_t& slave, const uint16_t& address, std::span<const uint16_t> values) {
+        try {
+            if (slave == 0 || slave > 247) {
+                throw std::invalid_argument("slave");
+            }
+            if (values.empty() || values.size() > MAX_WRITE_COUNT) {
+                throw std::invalid_argument("values size: " + std::to_string(values.size()));
+            }
+            std::byte* output = requestBuffer.data();
+            output[0] = static_cast<std::byte>(slave);
+            output[1] = std::byte(16);
+            output[2] = static_cast<std::byte>(address >> 8);
+            output[3] = static_cast<std::byte>(address & 0xFF);
+            output[4] = static_cast<std::byte>(values.size() >> 8);
+            output[5] = static_cast<std::byte>(values.size() & 0xFF);
+            output[6] = static_cast<std::byte>(values.size() * 2);
+            for (size_t i = 0; i < values.size(); i++) {
+                output[7 + i * 2] = static_cast<std::byte>(values[i] >> 8);
+                output[8 + i * 2] = static_cast<std::byte>(values[i] & 0xFF);
+            }
+            size_t size = 7 + values.size() * 2;
+            appendCrc(output, size);
+            Status status = transact(std::span<const std::byte>(output, size + 2), 8);
+            check(status, slave, static_cast<uint8_t>(responseBuffer[2]));
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<ModbusMaster::Response> ModbusMaster::poll(std::span<const Request> requests) {
+        try {
+            // All requests are encoded up front, so nothing but the frame gap separates a response from the next request.
+            std::vector<std::byte> frames(requests.size() * 8);
+            for (size_t i = 0; i < requests.size(); i++) {
+                encodeRead(frames.data() + i * 8, requests[i]);
+            }
+
+            std::vector<Response> result(requests.size());
+            for (size_t i = 0; i < requests.size(); i++) {
+                const Request& request = requests[i];
+                Response& response = result[i];
+                response.slave = request.slave;
+                response.function = request.function;
+                response.address = request.address;
+                Status status = transact(std::span<const std::byte>(frames.data() + i * 8, 8), 5 + request.count * 2);
+                if (status == Status::OK) {
+                    response.values.resize(request.count);
+                    for (size_t j = 0; j < request.count; j++) {
+                        response.values[j] = static_cast<uint16_t>((static_cast<uint16_t>(responseBuffer[3 + j * 2]) << 8) | static_cast<uint16_t>(responseBuffer[4 + j * 2]));
+                    }
+                } else if (status == Status::EXCEPTION) {
+                    response.exceptionCode = static_cast<uint8_t>(responseBuffer[2]);
+                } else if (status == Status::CORRUPTED) {
+                    response.corrupted = true;
+                } else {
+                    response.timedOut = true;
+                }
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    ModbusMaster::~ModbusMaster() noexcept {
+        if (readerStarted) {
+            try {
+                serial->stopReader();
+            } catch (...) {
+                // The reader stops with the port at the latest.
+            }
+        }
+    }
+
+    std::vector<uint16_t> ModbusMaster::readRegisters(const uint8_t& slave, const uint8_t& function, const uint16_t& address, const uint16_t& count) {
+        if (count == 0) {
+            throw std::invalid_argument("count");
+        }
+        if (static_cast<size_t>(address) + count > 65536) {
+            throw std::invalid_argument("address: " + std::to_string(address) + " count: " + std::to_string(count));
+        }
+        std::vector<uint16_t> result;
+        result.reserve(count);
+        for (size_t offset = 0; offset < count; offset += MAX_READ_COUNT) {
+            Request request;
+            request.slave = slave;
+            request.function = function;
+            request.address = static_cast<uint16_t>(address + offset);
+            request.count = static_cast<uint16_t>(std::min<size_t>(MAX_READ_COUNT, count - offset));
+            size_t size = encodeRead(requestBuffer.data(), request);
+            Status status = transact(std::span<const std::byte>(requestBuffer.data(), size), 5 + request.count * 2);
+            check(status, slave, static_cast<uint8_t>(responseBuffer[2]));
+            for (size_t j = 0; j < request.count; j++) {
+                result.emplace_back(static_cast<uint16_t>((static_cast<uint16_t>(responseBuffer[3 + j * 2]) << 8) | static_cast<uint16_t>(responseBuffer[4 + j * 2])));
+            }
+        }
+        return result;
+    }
+
+    size_t ModbusMaster::encodeRead(std::byte* output, const Request& request) {
+        if (request.slave == 0 || request.slave > 247) {
+            throw std::invalid_argument("slave: " + std::to_string(request.slave));
+        }
+        if (request.function != 3 && request.function != 4) {
+            throw std::invalid_argument("function: " + std::to_string(request.function));
+        }
+        if (request.count == 0 || request.count > MAX_READ_COUNT) {
+            throw std::invalid_argument("count: " + std::to_string(request.count));
+        }
+        output[0] = static_cast<std::byte>(request.slave);
+        output[1] = static_cast<std::byte>(request.function);
+        output[2] = static_cast<std::byte>(request.address >> 8);
+        output[3] = static_cast<std::byte>(request.address & 0xFF);
+        output[4] = static_cast<std::byte>(request.count >> 8);
+        output[5] = static_cast<std::byte>(request.count & 0xFF);
+        appendCrc(output, 6);
+        return 8;
+    }
+
+    ModbusMaster::Status ModbusMaster::transact(std::span<const std::byte> request, const size_t& responseSize) {
+        if (!serial->isReaderRunning()) {
+            serial->startReader(MAX_FRAME_SIZE * 16);
+            readerStarted = true;
+        }
+        std::this_thread::sleep_until(idleSince + frameGap);
+        discard();
+        serial->writeFrom(request);
+
+        bool corrupted = false;
+        size_t length = readFrame(request[1], responseSize, corrupted);
+        std::span<const std::byte> response(responseBuffer.data(), length);
+        idleSince = std::chrono::steady_clock::now();
+        if (length == 0) {
+            return Status::NO_RESPONSE;
+        }
+        if (corrupted || length < 5 || response[0] != request[0] || Crc::crc16Modbus(response) != 0) {
+            return Status::CORRUPTED;
+        }
+        if (response[1] == (request[1] | std::byte(0x80)) && length == 5) {
+            return Status::EXCEPTION;
+        }
+        if (response[1] == request[1] && length == responseSize && (responseSize == 8 || static_cast<size_t>(response[2]) == responseSize - 5)) {
+            return Status::OK;
+        }
+        return Status::CORRUPTED;
+    }
+
+    size_t ModbusMaster::readFrame(const std::byte& function, const size_t& responseSize, bool& corrupted) {
+        std::span<std::byte> response(responseBuffer);
+        std::byte scratch[64];
+        std::chrono::nanoseconds pollInterval = characterGap / 2;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point deadline = now + responseTimeout;
+        std::chrono::steady_clock::time_point lastByte = now;
+        std::chrono::steady_clock::time_point lastPoll = now;
+        size_t result = 0;
+        while (true) {
+            // Bytes past the largest frame are counted as a framing error and dropped.
+            std::span<std::byte> region = result < response.size() ? response.subspan(result) : std::span<std::byte>(scratch);
+            size_t length = serial->readInto(region);
+            now = std::chrono::steady_clock::now();
+            if (length > 0) {
+                // The bytes arrived after the previous empty poll, so the silence before them was at least this long.
+                if (result > 0 && lastPoll - lastByte > characterGap) {
+                    corrupted = true;
+                }
+                if (result >= response.size()) {
+                    corrupted = true;
+                } else {
+                    result += length;
+                }
+                lastByte = now;
+                lastPoll = now;
+                if (!corrupted && result >= 2 && result == (response[1] == (function | std::byte(0x80)) ? 5 : responseSize)) {
+                    return result;
+                }
+                continue;
+            }
+            lastPoll = now;
+            if (result > 0 ? now - lastByte >= frameGap : now >= deadline) {
+                return result;
+            }
+            std::this_thread::sleep_for(pollInterval);
+        }
+    }
+
+    void ModbusMaster::discard() {
+        std::span<std::byte> scratch(responseBuffer);
+        while (serial->readInto(scratch) > 0) {
+        }
+    }
+
+    void ModbusMaster::appendCrc(std::byte* data, const size_t& size) {
+        uint16_t crc = Crc::crc16Modbus(std::span<const std::byte>(data, size));
+        data[size] = static_cast<std::byte>(crc & 0xFF);
+        data[size + 1] = static_cast<std::byte>(crc >> 8);
+    }
+
+    void ModbusMaster::check(const Status& status, const uint8_t& slave, const uint8_t& exceptionCode) {
+        if (status == Status::EXCEPTION) {
+            throw std::runtime_error("slave: " + std::to_string(slave) + " exception code: " + std::to_string(exceptionCode));
+        }
+        if (status == Status::NO_RESPONSE) {
+            throw std::runtime_error("slave: " + std::to_string(slave) + " no response");
+        }
+        if (status == Status::CORRUPTED) {
+            throw std::runtime_error("slave: " + std::to_string(slave) + " corrupted response");
+        }
+    }
+
+}
+
+#undef CALL_INFO
+#undef MAX_READ_COUNT
+#undef MAX_WRITE_COUNT
+#undef MAX_FRAME_SIZE
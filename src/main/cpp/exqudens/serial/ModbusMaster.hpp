@@ -0,0 +1,205 @@
+/*!
+* @file ModbusMaster.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/ISerial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Modbus RTU master for one bus.
+    *
+    * Byte arrival is watched through the reader thread of the port, started on the first transaction if it is not running.
+    * A response ends after 3.5 characters of silence (t3.5), or as soon as its last byte arrives as the length of every
+    * response is known from its header, so only a silent slave costs the response timeout. A gap longer than 1.5 characters
+    * (t1.5) inside a response invalidates it. Consecutive requests are separated by the frame gap and nothing else.
+    */
+    class EXQUDENS_SERIAL_EXPORT ModbusMaster {
+
+        public:
+
+            struct Request {
+                uint8_t slave = 0;      //!< A slave address 1-247.
+                uint8_t function = 3;   //!< A function 3 (read holding registers) or 4 (read input registers).
+                uint16_t address = 0;   //!< A first register address.
+                uint16_t count = 0;     //!< A register count 1-125.
+            };
+
+            struct Response {
+                uint8_t slave = 0;              //!< A slave address of the request.
+                uint8_t function = 0;           //!< A function of the request.
+                uint16_t address = 0;           //!< A first register address of the request.
+                std::vector<uint16_t> values;   //!< A register values, empty on failure.
+                uint8_t exceptionCode = 0;      //!< A Modbus exception code, 0 if the slave did not report an exception.
+                bool timedOut = false;          //!< @b true if the slave did not respond within the response timeout.
+                bool corrupted = false;         //!< @b true if the response failed the CRC, framing or gap checks.
+            };
+
+        private:
+
+            enum class Status {
+                OK,
+                EXCEPTION,
+                NO_RESPONSE,
+                CORRUPTED
+            };
+
+            std::shared_ptr<ISerial> serial = nullptr;
+            std::chrono::nanoseconds characterGap = std::chrono::nanoseconds(0);
+            std::chrono::nanoseconds frameGap = std::chrono::nanoseconds(0);
+            std::chrono::milliseconds responseTimeout = std::chrono::milliseconds(0);
+            bool readerStarted = false;
+            std::chrono::steady_clock::time_point idleSince = std::chrono::steady_clock::time_point();
+            std::vector<std::byte> requestBuffer;
+            std::vector<std::byte> responseBuffer;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ModbusMaster(
+                const std::shared_ptr<ISerial>& serial,         //!< An open port.
+                const unsigned int& baudRate,                   //!< A baud rate the port is opened with.
+                const unsigned int& characterBits = 11,         //!< A number of bits per character including start, parity and stop bits.
+                const std::chrono::milliseconds& responseTimeout = std::chrono::milliseconds(1000) //!< A time a slave has to start its response.
+            );
+
+            ModbusMaster(const ModbusMaster&) = delete;
+
+            ModbusMaster& operator=(const ModbusMaster&) = delete;
+
+            /*!
+            * Gets maximal silence inside a frame (t1.5), fixed to 750 microseconds above 19200 baud.
+            *
+            * @return A duration.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::chrono::nanoseconds getCharacterGap() const;
+
+            /*!
+            * Gets minimal silence between frames (t3.5), fixed to 1750 microseconds above 19200 baud.
+            *
+            * @return A duration.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::chrono::nanoseconds getFrameGap() const;
+
+            /*!
+            * Reads holding registers (function 3), ranges longer than 125 registers are split into several requests.
+            *
+            * @return A register values.
+            *
+            * @throws std::runtime_error if the slave reports an exception, does not respond or responds with a corrupted frame.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<uint16_t> readHoldingRegisters(
+                const uint8_t& slave,       //!< A slave address.
+                const uint16_t& address,    //!< A first register address.
+                const uint16_t& count       //!< A register count.
+            );
+
+            /*!
+            * Reads scattered holding registers with as few requests as possible,
+            * addresses closer than 'maxGap' registers are read with one request.
+            *
+            * @return A register values by address.
+            *
+            * @throws std::runtime_error if the slave reports an exception, does not respond or responds with a corrupted frame.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::map<uint16_t, uint16_t> readHoldingRegisters(
+                const uint8_t& slave,                   //!< A slave address.
+                const std::vector<uint16_t>& addresses, //!< A register addresses in any order.
+                const uint16_t& maxGap = 8              //!< A maximal number of unwanted registers read between two wanted ones.
+            );
+
+            /*!
+            * Reads input registers (function 4), ranges longer than 125 registers are split into several requests.
+            *
+            * @return A register values.
+            *
+            * @throws std::runtime_error if the slave reports an exception, does not respond or responds with a corrupted frame.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<uint16_t> readInputRegisters(
+                const uint8_t& slave,       //!< A slave address.
+                const uint16_t& address,    //!< A first register address.
+                const uint16_t& count       //!< A register count.
+            );
+
+            /*!
+            * Writes one register (function 6).
+            *
+            * @throws std::runtime_error if the slave reports an exception, does not respond or responds with a corrupted frame.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void writeSingleRegister(
+                const uint8_t& slave,       //!< A slave address.
+                const uint16_t& address,    //!< A register address.
+                const uint16_t& value       //!< A register value.
+            );
+
+            /*!
+            * Writes consecutive registers (function 16).
+            *
+            * @throws std::runtime_error if the slave reports an exception, does not respond or responds with a corrupted frame.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void writeMultipleRegisters(
+                const uint8_t& slave,               //!< A slave address.
+                const uint16_t& address,            //!< A first register address.
+                std::span<const uint16_t> values    //!< A register values, 1-123.
+            );
+
+            /*!
+            * Performs read requests to any slaves back to back, a failing slave does not stop the poll.
+            *
+            * @return A response for every request in the request order.
+            *
+            * @throws std::runtime_error if a request is invalid or the port fails.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<Response> poll(
+                std::span<const Request> requests //!< A requests.
+            );
+
+            /*!
+            * Destructor, stops the reader thread of the port if it was started by this master.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~ModbusMaster() noexcept;
+
+        private:
+
+            std::vector<uint16_t> readRegisters(const uint8_t& slave, const uint8_t& function, const uint16_t& address, const uint16_t& count);
+
+            size_t encodeRead(std::byte* output, const Request& request);
+
+            Status transact(std::span<const std::byte> request, const size_t& responseSize);
+
+            size_t readFrame(const std::byte& function, const size_t& responseSize, bool& corrupted);
+
+            void discard();
+
+            static void appendCrc(std::byte* data, const size_t& size);
+
+            static void check(const Status& status, const uint8_t& slave, const uint8_t& exceptionCode);
+
+    };
+
+}
@@ -0,0 +1,155 @@
+/*!
+* @file PacketChannel.cpp
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "exqudens/serial/PacketChannel.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+#include "exqudens/serial/Crc.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define HEADER_SIZE 3
+#define MAX_PAYLOAD_SIZE 65535
+
+namespace exqudens {
+
+    PacketChannel::PacketChannel(
+        const std::shared_ptr<ISerial>& serial,
+        const Checksum& checksum,
+        const size_t& maxPayloadSize,
+        const std::byte& sync
+    ):
+        serial(serial),
+        checksum(checksum),
+        maxPayloadSize(maxPayloadSize),
+        sync(sync)
+    {
+        try {
+            if (!serial) {
+                throw std::invalid_argument("serial");
+            }
+            if (maxPayloadSize > MAX_PAYLOAD_SIZE) {
+                throw std::invalid_argument("maxPayloadSize");
+            }
+            if (checksum == Checksum::CRC16) {
+                checksumSize = 2;
+            } else if (checksum == Checksum::CRC32C) {
+                checksumSize = 4;
+            } else {
+                throw std::invalid_argument("checksum");
+            }
+            writeBuffer.resize(getPacketSize(maxPayloadSize));
+            readBuffer.resize(writeBuffer.size() * 2);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    PacketChannel::Checksum PacketChannel::getChecksum() const {
+        return checksum;
+    }
+
+    size_t PacketChannel::send(std::span<const std::byte> payload) {
+        try {
+            if (payload.size() > maxPayloadSize) {
+                throw std::length_error("payload size: " + std::to_string(payload.size()) + " greater than: " + std::to_string(maxPayloadSize));
+            }
+            writeBuffer[0] = sync;
+            writeBuffer[1] = static_cast<std::byte>(payload.size() & 0xFF);
+            writeBuffer[2] = static_cast<std::byte>(payload.size() >> 8);
+            if (!payload.empty()) {
+                std::memcpy(writeBuffer.data() + HEADER_SIZE, payload.data(), payload.size());
+            }
+            std::span<const std::byte> covered(writeBuffer.data() + 1, HEADER_SIZE - 1 + payload.size());
+            uint32_t value = checksum == Checksum::CRC16 ? Crc::crc16(covered) : Crc::crc32c(covered);
+            for (size_t i = 0; i < checksumSize; i++) {
+                writeBuffer[HEADER_SIZE + payload.size() + i] = static_cast<std::byte>((value >> (i * 8)) & 0xFF);
+            }
+            return serial->writeFrom(std::span<const std::byte>(writeBuffer).first(getPacketSize(payload.size())));
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PacketChannel::receive(const std::function<void(std::span<const std::byte> payload)>& handler) {
+        try {
+            if (readBufferBegin > 0) {
+                std::memmove(readBuffer.data(), readBuffer.data() + readBufferBegin, readBufferEnd - readBufferBegin);
+                readBufferEnd -= readBufferBegin;
+                readBufferBegin = 0;
+            }
+            readBufferEnd += serial->readInto(std::span<std::byte>(readBuffer).subspan(readBufferEnd));
+
+            size_t result = 0;
+            while (true) {
+                size_t index = readBufferBegin + ByteScanner::find(
+                    std::span<const std::byte>(readBuffer.data() + readBufferBegin, readBufferEnd - readBufferBegin),
+                    sync
+                );
+                skippedCount += index - readBufferBegin;
+                readBufferBegin = index;
+                if (readBufferEnd - readBufferBegin < HEADER_SIZE) {
+                    break;
+                }
+                size_t payloadSize = static_cast<size_t>(readBuffer[readBufferBegin + 1]) | (static_cast<size_t>(readBuffer[readBufferBegin + 2]) << 8);
+                if (payloadSize > maxPayloadSize) {
+                    corruptedCount++;
+                    skippedCount++;
+                    readBufferBegin++;
+                    continue;
+                }
+                size_t packetSize = getPacketSize(payloadSize);
+                if (readBufferEnd - readBufferBegin < packetSize) {
+                    break;
+                }
+                std::span<const std::byte> packet(readBuffer.data() + readBufferBegin, packetSize);
+                if (!verify(packet)) {
+                    corruptedCount++;
+                    skippedCount++;
+                    readBufferBegin++;
+                    continue;
+                }
+                readBufferBegin += packetSize;
+                handler(packet.subspan(HEADER_SIZE, payloadSize));
+                result++;
+            }
+
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PacketChannel::getCorruptedCount() const {
+        return corruptedCount;
+    }
+
+    size_t PacketChannel::getSkippedCount() const {
+        return skippedCount;
+    }
+
+    size_t PacketChannel::getPacketSize(const size_t& payloadSize) const {
+        return HEADER_SIZE + payloadSize + checksumSize;
+    }
+
+    bool PacketChannel::verify(std::span<const std::byte> packet) const {
+        std::span<const std::byte> covered = packet.subspan(1, packet.size() - 1 - checksumSize);
+        uint32_t expected = 0;
+        for (size_t i = 0; i < checksumSize; i++) {
+            expected |= static_cast<uint32_t>(packet[packet.size() - checksumSize + i]) << (i * 8);
+        }
+        if (checksum == Checksum::CRC16) {
+            return Crc::crc16(covered) == expected;
+        }
+        return Crc::crc32c(covered) == expected;
+    }
+
+}
+
+#undef CALL_INFO
+#undef HEADER_SIZE
+#undef MAX_PAYLOAD_SIZE
@@ -0,0 +1,124 @@
+/*!
+* @file PacketChannel.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/ISerial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Sends and receives length prefixed packets with a CRC trailer over a port.
+    *
+    * Packet layout: sync byte, payload length (2 bytes little endian), payload,
+    * CRC of length and payload (little endian, 2 bytes for CRC-16/CCITT or 4 bytes for CRC-32C).
+    * After a bad length or checksum the receiver slides one byte forward to the next sync byte,
+    * so a corrupted or truncated packet costs only the bytes up to the next valid packet.
+    */
+    class EXQUDENS_SERIAL_EXPORT PacketChannel {
+
+        public:
+
+            enum class Checksum {
+                CRC16,  //!< CRC-16/CCITT-FALSE trailer.
+                CRC32C  //!< CRC-32C trailer.
+            };
+
+        private:
+
+            std::shared_ptr<ISerial> serial = nullptr;
+            Checksum checksum = Checksum::CRC16;
+            size_t checksumSize = 0;
+            size_t maxPayloadSize = 0;
+            std::byte sync = std::byte(0);
+            std::vector<std::byte> readBuffer;
+            size_t readBufferBegin = 0;
+            size_t readBufferEnd = 0;
+            std::vector<std::byte> writeBuffer;
+            size_t corruptedCount = 0;
+            size_t skippedCount = 0;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            PacketChannel(
+                const std::shared_ptr<ISerial>& serial,     //!< A port.
+                const Checksum& checksum,                   //!< A checksum.
+                const size_t& maxPayloadSize = 4096,        //!< A maximal payload size in bytes, at most 65535.
+                const std::byte& sync = std::byte(0x7E)     //!< A sync byte starting every packet.
+            );
+
+            PacketChannel(const PacketChannel&) = delete;
+
+            PacketChannel& operator=(const PacketChannel&) = delete;
+
+            /*!
+            * Gets checksum.
+            *
+            * @return A checksum.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Checksum getChecksum() const;
+
+            /*!
+            * Writes one packet.
+            *
+            * @return A number of packet bytes written.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t send(
+                std::span<const std::byte> payload //!< A payload, at most 'maxPayloadSize' bytes.
+            );
+
+            /*!
+            * Performs one read from the port and passes the payload of every complete valid packet to the handler.
+            *
+            * @return A number of packets passed to the handler.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t receive(
+                const std::function<void(std::span<const std::byte> payload)>& handler //!< A handler, the view points into the receive buffer and is valid during the call only.
+            );
+
+            /*!
+            * Gets number of candidate packets rejected because of a bad length or checksum.
+            *
+            * @return A packet count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getCorruptedCount() const;
+
+            /*!
+            * Gets number of received bytes skipped while searching for a valid packet.
+            *
+            * @return A byte count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getSkippedCount() const;
+
+        private:
+
+            size_t getPacketSize(const size_t& payloadSize) const;
+
+            bool verify(std::span<const std::byte> packet) const;
+
+    };
+
+}
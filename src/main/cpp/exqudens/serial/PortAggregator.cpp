@@ -0,0 +1,277 @@
+/*!
+* @file PortAggregator.cpp
+*/
+
+#include <cerrno>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "exqudens/serial/PortAggregator.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    namespace {
+
+        int64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        timespec toTimespec(const std::chrono::nanoseconds& value) {
+            return {static_cast<time_t>(value.count() / 1000000000), static_cast<long>(value.count() % 1000000000)};
+        }
+
+    }
+
+    PortAggregator::PortAggregator(
+        const std::vector<std::shared_ptr<Serial>>& ports,
+        const size_t& chunkSize,
+        const size_t& queueCapacity,
+        const std::chrono::microseconds& maxDelay
+    ):
+        chunkSize(chunkSize),
+        maxDelay(maxDelay)
+    {
+        try {
+            if (ports.empty()) {
+                throw std::invalid_argument("ports");
+            }
+            if (chunkSize == 0) {
+                throw std::invalid_argument("chunkSize");
+            }
+            if (queueCapacity == 0) {
+                throw std::invalid_argument("queueCapacity");
+            }
+            if (maxDelay.count() <= 0) {
+                throw std::invalid_argument("maxDelay");
+            }
+            for (const std::shared_ptr<Serial>& serial : ports) {
+                if (!serial || !serial->isOpen() || serial->getNativeHandle() < 0) {
+                    throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
+                }
+                std::unique_ptr<Port> port = std::make_unique<Port>();
+                port->serial = serial;
+                port->fd = serial->getNativeHandle();
+                port->journal = serial->getJournal();
+                port->slots.resize(queueCapacity);
+                port->bytes.resize(queueCapacity * chunkSize);
+                port->watermark.store(now(), std::memory_order_relaxed);
+                this->ports.emplace_back(std::move(port));
+            }
+            stopHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            wakeHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (stopHandle < 0 || wakeHandle < 0) {
+                int error = errno;
+                release();
+                throw std::system_error(error, std::generic_category(), "eventfd");
+            }
+            try {
+                for (std::unique_ptr<Port>& port : this->ports) {
+                    port->thread = std::thread(&PortAggregator::run, this, std::ref(*port));
+                }
+            } catch (...) {
+                stop();
+                release();
+                throw;
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PortAggregator::poll(const Handler& handler) {
+        try {
+            if (!handler) {
+                throw std::invalid_argument("handler");
+            }
+            size_t result = 0;
+            while (true) {
+                size_t next = ports.size();
+                int64_t nextTime = std::numeric_limits<int64_t>::max();
+                int64_t bound = std::numeric_limits<int64_t>::max();
+                for (size_t i = 0; i < ports.size(); i++) {
+                    Port* port = ports.at(i).get();
+                    // The watermark is loaded before the queue, a chunk pushed before it was published is then visible.
+                    int64_t watermark = port->watermark.load(std::memory_order_acquire);
+                    size_t head = port->head.load(std::memory_order_relaxed);
+                    if (head == port->tail.load(std::memory_order_acquire)) {
+                        bound = std::min(bound, watermark);
+                        continue;
+                    }
+                    int64_t time = port->slots.at(head % port->slots.size()).time;
+                    if (time < nextTime) {
+                        next = i;
+                        nextTime = time;
+                    }
+                }
+                if (next == ports.size() || nextTime > bound) {
+                    return result;
+                }
+                Port& port = *ports.at(next);
+                size_t head = port.head.load(std::memory_order_relaxed);
+                size_t index = head % port.slots.size();
+                Chunk chunk;
+                chunk.port = next;
+                chunk.time = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(nextTime));
+                chunk.bytes = std::span<const std::byte>(port.bytes.data() + index * chunkSize, port.slots.at(index).size);
+                handler(chunk);
+                port.head.store(head + 1, std::memory_order_release);
+                result++;
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PortAggregator::wait(const Handler& handler, const std::chrono::milliseconds& timeout) {
+        try {
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+            while (true) {
+                size_t result = poll(handler);
+                if (result > 0) {
+                    return result;
+                }
+                // Readers signal only while 'waiting' is set, the second poll catches what they pushed before seeing it.
+                waiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                result = poll(handler);
+                std::chrono::nanoseconds left = deadline - std::chrono::steady_clock::now();
+                if (result == 0 && left.count() > 0) {
+                    timespec value = toTimespec(left);
+                    pollfd entry = {wakeHandle, POLLIN, 0};
+                    if (ppoll(&entry, 1, &value, nullptr) < 0 && errno != EINTR) {
+                        waiting.store(false);
+                        throw std::system_error(errno, std::generic_category(), "ppoll");
+                    }
+                    uint64_t count = 0;
+                    ssize_t ignored = ::read(wakeHandle, &count, sizeof(count));
+                    (void) ignored;
+                }
+                waiting.store(false);
+                if (result > 0 || left.count() <= 0) {
+                    return result;
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::exception_ptr PortAggregator::getPortException(const size_t& port) {
+        try {
+            Port& value = *ports.at(port);
+            if (!value.failed.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            return value.exception;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PortAggregator::stop() noexcept {
+        if (stopped.exchange(true)) {
+            return;
+        }
+        if (stopHandle >= 0) {
+            uint64_t value = 1;
+            ssize_t ignored = ::write(stopHandle, &value, sizeof(value));
+            (void) ignored;
+        }
+        for (std::unique_ptr<Port>& port : ports) {
+            if (port->thread.joinable()) {
+                port->thread.join();
+            }
+        }
+    }
+
+    PortAggregator::~PortAggregator() noexcept {
+        stop();
+        release();
+    }
+
+    void PortAggregator::run(Port& port) {
+        try {
+            timespec idle = toTimespec(maxDelay);
+            timespec backoff = toTimespec(std::min<std::chrono::nanoseconds>(maxDelay, std::chrono::microseconds(100)));
+            while (true) {
+                size_t tail = port.tail.load(std::memory_order_relaxed);
+                if (tail - port.head.load(std::memory_order_acquire) == port.slots.size()) {
+                    pollfd entry = {stopHandle, POLLIN, 0};
+                    if (ppoll(&entry, 1, &backoff, nullptr) > 0) {
+                        break;
+                    }
+                    continue;
+                }
+                // Every chunk read from now on is stamped later than the published watermark.
+                port.watermark.store(now(), std::memory_order_release);
+                notify();
+                size_t index = tail % port.slots.size();
+                ssize_t length = ::read(port.fd, port.bytes.data() + index * chunkSize, chunkSize);
+                if (length > 0) {
+                    port.slots.at(index) = {now(), static_cast<size_t>(length)};
+                    if (port.journal) {
+                        port.journal->append(Journal::Direction::READ, std::span<const std::byte>(port.bytes.data() + index * chunkSize, static_cast<size_t>(length)));
+                    }
+                    port.tail.store(tail + 1, std::memory_order_release);
+                    notify();
+                    continue;
+                }
+                if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "read");
+                }
+                pollfd entries[2] = {{port.fd, POLLIN, 0}, {stopHandle, POLLIN, 0}};
+                if (ppoll(entries, 2, &idle, nullptr) < 0 && errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "ppoll");
+                }
+                if ((entries[1].revents & POLLIN) != 0) {
+                    break;
+                }
+                if ((entries[0].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0) {
+                    throw std::system_error(std::make_error_code(std::errc::io_error), "poll revents: " + std::to_string(entries[0].revents));
+                }
+            }
+        } catch (...) {
+            try {
+                std::throw_with_nested(std::runtime_error(CALL_INFO));
+            } catch (...) {
+                port.exception = std::current_exception();
+            }
+            port.failed.store(true, std::memory_order_release);
+        }
+        // A stopped or failed port never delivers again, its queued chunks are merged with the others.
+        port.watermark.store(std::numeric_limits<int64_t>::max(), std::memory_order_release);
+        notify();
+    }
+
+    void PortAggregator::notify() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed)) {
+            uint64_t value = 1;
+            ssize_t ignored = ::write(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+        }
+    }
+
+    void PortAggregator::release() noexcept {
+        if (stopHandle >= 0) {
+            ::close(stopHandle);
+            stopHandle = -1;
+        }
+        if (wakeHandle >= 0) {
+            ::close(wakeHandle);
+            wakeHandle = -1;
+        }
+    }
+
+}
+
+#undef CALL_INFO
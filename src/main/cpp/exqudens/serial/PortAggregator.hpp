@@ -0,0 +1,152 @@
+/*!
+* @file PortAggregator.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Merges the bytes received on many open ports into one stream in receive time order (Linux only).
+    *
+    * Every port has a reader thread that reads its native handle, stamps each chunk with the monotonic time the read returned
+    * and pushes it to a single-producer single-consumer queue of the port. The consumer merges the queue heads (k-way merge)
+    * without locks. A chunk is handed over only when no port can still deliver an older one, every reader publishes
+    * a watermark before each read and at least every 'maxDelay' while its port is idle, which bounds the merge latency.
+    *
+    * A full port queue stops reading that port until the consumer catches up, the bytes wait in the driver buffer meanwhile.
+    * Bytes read by the aggregator are not seen by the 'Serial' read functions, they are recorded to the journal the port had
+    * when the aggregator was constructed. 'poll' and 'wait' must be called from one thread.
+    */
+    class EXQUDENS_SERIAL_EXPORT PortAggregator {
+
+        public:
+
+            struct Chunk {
+                size_t port = 0;                                //!< A port index in the constructor list.
+                std::chrono::steady_clock::time_point time;     //!< A time the read of the chunk returned.
+                std::span<const std::byte> bytes;               //!< A bytes read, valid during the handler call only.
+            };
+
+            using Handler = std::function<void(const Chunk& chunk)>;
+
+        private:
+
+            struct Slot {
+                int64_t time = 0;
+                size_t size = 0;
+            };
+
+            struct Port {
+                std::shared_ptr<Serial> serial = nullptr;
+                int fd = -1;
+                std::shared_ptr<Journal> journal = nullptr;
+                std::vector<Slot> slots;
+                std::vector<std::byte> bytes;
+                alignas(64) std::atomic<size_t> head = 0;
+                alignas(64) std::atomic<size_t> tail = 0;
+                alignas(64) std::atomic<int64_t> watermark = 0;
+                std::atomic<bool> failed = false;
+                std::exception_ptr exception = nullptr;
+                std::thread thread;
+            };
+
+            std::vector<std::unique_ptr<Port>> ports;
+            size_t chunkSize = 0;
+            std::chrono::nanoseconds maxDelay = std::chrono::nanoseconds(0);
+            int stopHandle = -1;
+            int wakeHandle = -1;
+            std::atomic<bool> waiting = false;
+            std::atomic<bool> stopped = false;
+
+        public:
+
+            /*!
+            * Constructor, starts the reader threads.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            PortAggregator(
+                const std::vector<std::shared_ptr<Serial>>& ports,                          //!< An open ports.
+                const size_t& chunkSize = 256,                                              //!< A maximal size of one chunk.
+                const size_t& queueCapacity = 1024,                                         //!< A number of chunks a port queue holds.
+                const std::chrono::microseconds& maxDelay = std::chrono::microseconds(1000) //!< A watermark period of an idle port.
+            );
+
+            PortAggregator(const PortAggregator&) = delete;
+
+            PortAggregator& operator=(const PortAggregator&) = delete;
+
+            /*!
+            * Hands over, oldest first, every chunk that can not be preceded by a chunk still to be read, without waiting.
+            *
+            * @return A number of chunks handed over.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t poll(
+                const Handler& handler //!< A chunk consumer.
+            );
+
+            /*!
+            * Waits until at least one chunk was handed over, see 'poll', or the timeout expires.
+            *
+            * @return A number of chunks handed over, @b 0 on timeout.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t wait(
+                const Handler& handler,                     //!< A chunk consumer.
+                const std::chrono::milliseconds& timeout    //!< A time limit.
+            );
+
+            /*!
+            * Gets the failure of a port reader, a failed port no longer holds back the other ports.
+            *
+            * @return An exception, or @b nullptr if the reader runs.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::exception_ptr getPortException(
+                const size_t& port //!< A port index in the constructor list.
+            );
+
+            /*!
+            * Stops the reader threads, chunks already queued can still be handed over.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void stop() noexcept;
+
+            /*!
+            * Destructor, calls 'stop'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~PortAggregator() noexcept;
+
+        private:
+
+            void run(Port& port);
+
+            void notify() noexcept;
+
+            void release() noexcept;
+
+    };
+
+}
@@ -0,0 +1,27 @@
+/*!
+* @file PortInfo.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace exqudens {
+
+    /*!
+    * Typed description of a serial port, the fields hold the same values as the 'listPorts' map entries.
+    *
+    * The views point into the arena of the 'PortList' holding the entry and are valid as long as that list.
+    */
+    struct PortInfo {
+        std::string_view port;          //!< A port address, like '/dev/ttyUSB0'.
+        std::string_view description;   //!< A human readable description.
+        std::string_view hardwareId;    //!< A hardware id, like 'USB VID:PID=0483:5740 SNR=...'.
+        uint16_t vendorId = 0;          //!< A USB vendor id parsed from the hardware id, zero if there is none.
+        uint16_t productId = 0;         //!< A USB product id parsed from the hardware id, zero if there is none.
+
+        bool operator==(const PortInfo&) const = default;
+    };
+
+}
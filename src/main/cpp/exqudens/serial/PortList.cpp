@@ -0,0 +1,166 @@
+/*!
+* @file PortList.cpp
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
+#include <stdexcept>
+
+#include "exqudens/serial/PortList.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    namespace {
+
+        bool parseHex(std::string_view value, uint16_t& result) {
+            if (value.size() < 4) {
+                return false;
+            }
+            uint16_t parsed = 0;
+            std::from_chars_result status = std::from_chars(value.data(), value.data() + 4, parsed, 16);
+            if (status.ec != std::errc() || status.ptr != value.data() + 4) {
+                return false;
+            }
+            result = parsed;
+            return true;
+        }
+
+    }
+
+    PortList::PortList(const PortList& other): arena(other.arena), entries(other.entries) {
+        rebase(other.arena.data(), arena.data());
+    }
+
+    PortList& PortList::operator=(const PortList& other) {
+        if (this != &other) {
+            PortList copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    void PortList::reserve(const size_t& count, const size_t& bytes) {
+        try {
+            entries.reserve(count);
+            if (arena.capacity() < bytes) {
+                std::vector<char> next;
+                next.reserve(bytes);
+                next.assign(arena.begin(), arena.end());
+                rebase(arena.data(), next.data());
+                arena.swap(next);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool PortList::add(
+        std::string_view port,
+        std::string_view description,
+        std::string_view hardwareId,
+        const Predicate& predicate
+    ) {
+        try {
+            size_t mark = arena.size();
+            size_t required = port.size() + description.size() + hardwareId.size();
+            if (arena.capacity() - mark < required) {
+                reserve(entries.size() + 1, std::max(arena.capacity() * 2, mark + required));
+            }
+
+            // Normalized in place, the capacity reserved above guarantees the views stay valid while appending.
+            std::string_view values[3] = {port, description, hardwareId};
+            std::string_view normalized[3] = {};
+            for (size_t i = 0; i < 3; i++) {
+                size_t offset = arena.size();
+                for (char c : values[i]) {
+                    if (std::isalnum(static_cast<unsigned char>(c)) != 0 || std::ispunct(static_cast<unsigned char>(c)) != 0) {
+                        arena.push_back(c);
+                    } else if (std::isspace(static_cast<unsigned char>(c)) != 0) {
+                        arena.push_back(' ');
+                    }
+                }
+                if (arena.size() > offset) {
+                    normalized[i] = std::string_view(arena.data() + offset, arena.size() - offset);
+                }
+            }
+
+            PortInfo entry = {normalized[0], normalized[1], normalized[2]};
+            parseUsbId(entry.hardwareId, entry.vendorId, entry.productId);
+            if (predicate && !predicate(entry)) {
+                arena.resize(mark);
+                return false;
+            }
+            entries.emplace_back(entry);
+            return true;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PortList::size() const {
+        return entries.size();
+    }
+
+    bool PortList::empty() const {
+        return entries.empty();
+    }
+
+    const PortInfo& PortList::at(const size_t& index) const {
+        try {
+            return entries.at(index);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<PortInfo>::const_iterator PortList::begin() const {
+        return entries.begin();
+    }
+
+    std::vector<PortInfo>::const_iterator PortList::end() const {
+        return entries.end();
+    }
+
+    bool PortList::parseUsbId(std::string_view hardwareId, uint16_t& vendorId, uint16_t& productId) {
+        uint16_t vendor = 0;
+        uint16_t product = 0;
+        size_t index = hardwareId.find("VID:PID=");
+        if (index != std::string_view::npos) {
+            std::string_view value = hardwareId.substr(index + 8);
+            if (value.size() < 9 || value[4] != ':' || !parseHex(value, vendor) || !parseHex(value.substr(5), product)) {
+                return false;
+            }
+        } else {
+            size_t vendorIndex = hardwareId.find("VID_");
+            size_t productIndex = hardwareId.find("PID_");
+            if (
+                vendorIndex == std::string_view::npos
+                || productIndex == std::string_view::npos
+                || !parseHex(hardwareId.substr(vendorIndex + 4), vendor)
+                || !parseHex(hardwareId.substr(productIndex + 4), product)
+            ) {
+                return false;
+            }
+        }
+        vendorId = vendor;
+        productId = product;
+        return true;
+    }
+
+    void PortList::rebase(const char* from, const char* to) {
+        for (PortInfo& entry : entries) {
+            for (std::string_view* value : {&entry.port, &entry.description, &entry.hardwareId}) {
+                if (!value->empty()) {
+                    *value = std::string_view(to + (value->data() - from), value->size());
+                }
+            }
+        }
+    }
+
+}
+
+#undef CALL_INFO
@@ -0,0 +1,125 @@
+/*!
+* @file PortList.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/PortInfo.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Port enumeration result, all strings of all entries are stored in one arena owned by the list.
+    *
+    * Moving keeps the entries valid, copying rebases them onto the arena of the copy.
+    */
+    class EXQUDENS_SERIAL_EXPORT PortList {
+
+        public:
+
+            using Predicate = std::function<bool(const PortInfo& port)>;
+
+        private:
+
+            std::vector<char> arena;
+            std::vector<PortInfo> entries;
+
+        public:
+
+            PortList() = default;
+
+            EXQUDENS_SERIAL_INLINE
+            PortList(const PortList& other);
+
+            PortList(PortList&& other) noexcept = default;
+
+            EXQUDENS_SERIAL_INLINE
+            PortList& operator=(const PortList& other);
+
+            PortList& operator=(PortList&& other) noexcept = default;
+
+            /*!
+            * Reserves storage so that adding up to the given amounts does not allocate.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void reserve(
+                const size_t& count,    //!< A number of entries.
+                const size_t& bytes     //!< A total length of their strings.
+            );
+
+            /*!
+            * Normalizes the strings into the arena and keeps the entry if the predicate accepts it.
+            *
+            * A rejected entry is rolled back, it leaves no allocation behind.
+            *
+            * @return True if the entry was kept.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool add(
+                std::string_view port,                  //!< A port address.
+                std::string_view description,           //!< A description.
+                std::string_view hardwareId,            //!< A hardware id, the USB vendor and product ids are parsed from it.
+                const Predicate& predicate = {}         //!< A filter called with the normalized entry, empty accepts all.
+            );
+
+            /*!
+            * Gets number of entries.
+            *
+            * @return A number of entries.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t size() const;
+
+            /*!
+            * Checks if there are no entries.
+            *
+            * @return True if there are no entries.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool empty() const;
+
+            /*!
+            * Gets an entry.
+            *
+            * @return An entry at the index.
+            *
+            * @throws std::out_of_range if index is not less than size.
+            */
+            EXQUDENS_SERIAL_INLINE
+            const PortInfo& at(
+                const size_t& index //!< An entry index.
+            ) const;
+
+            EXQUDENS_SERIAL_INLINE
+            std::vector<PortInfo>::const_iterator begin() const;
+
+            EXQUDENS_SERIAL_INLINE
+            std::vector<PortInfo>::const_iterator end() const;
+
+            /*!
+            * Parses USB vendor and product ids from a hardware id.
+            *
+            * Accepts the 'VID:PID=0483:5740' form reported on Linux and macOS and the 'VID_0483&PID_5740' form reported on Windows.
+            *
+            * @return True if both ids were found.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static bool parseUsbId(
+                std::string_view hardwareId,    //!< A hardware id.
+                uint16_t& vendorId,             //!< A parsed vendor id, unchanged if not found.
+                uint16_t& productId             //!< A parsed product id, unchanged if not found.
+            );
+
+        private:
+
+            void rebase(const char* from, const char* to);
+
+    };
+
+}
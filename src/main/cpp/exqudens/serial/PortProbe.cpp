@@ -0,0 +1,107 @@
+/*!
+* @file PortProbe.cpp
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+
+#include "exqudens/serial/PortProbe.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    PortProbe::PortProbe(
+        const size_t& workerCount,
+        const unsigned int& timeout,
+        const Opener& opener,
+        const Factory& factory
+    ):
+        workerCount(workerCount),
+        opener(opener),
+        factory(factory)
+    {
+        try {
+            if (workerCount == 0) {
+                throw std::invalid_argument("workerCount");
+            }
+            if (!this->opener) {
+                this->opener = [timeout](ISerial& serial, const std::string& port) {
+                    serial.open(port, timeout);
+                };
+            }
+            if (!this->factory) {
+                this->factory = [] {
+                    return std::make_shared<Serial>();
+                };
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<PortProbe::Match> PortProbe::probePorts(const PortList& ports, const Handshake& handshake) {
+        try {
+            if (!handshake) {
+                throw std::invalid_argument("handshake");
+            }
+
+            std::vector<std::optional<std::string>> identities(ports.size());
+            std::atomic<size_t> next = 0;
+            auto work = [this, &ports, &handshake, &identities, &next] {
+                for (size_t i = next.fetch_add(1); i < ports.size(); i = next.fetch_add(1)) {
+                    try {
+                        std::shared_ptr<ISerial> serial = factory();
+                        opener(*serial, std::string(ports.at(i).port));
+                        identities.at(i) = handshake(*serial, ports.at(i));
+                        serial->close();
+                    } catch (...) {
+                        // Not a match, a busy, vanished or foreign device must not abort the other probes.
+                    }
+                }
+            };
+
+            std::vector<std::thread> workers;
+            size_t count = std::min(workerCount, ports.size());
+            workers.reserve(count);
+            try {
+                for (size_t i = 0; i < count; i++) {
+                    workers.emplace_back(work);
+                }
+            } catch (...) {
+                // Fewer workers than requested, the started ones take over the remaining candidates.
+                if (workers.empty()) {
+                    throw;
+                }
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            std::vector<Match> results;
+            for (size_t i = 0; i < identities.size(); i++) {
+                if (identities.at(i).has_value()) {
+                    results.emplace_back(Match {std::string(ports.at(i).port), identities.at(i).value()});
+                }
+            }
+            return results;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<PortProbe::Match> PortProbe::probePorts(const Handshake& handshake) {
+        try {
+            return probePorts(factory()->findPorts(), handshake);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+}
+
+#undef CALL_INFO
@@ -0,0 +1,95 @@
+/*!
+* @file PortProbe.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/ISerial.hpp"
+#include "exqudens/serial/PortList.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Identifies devices on many ports at once, each candidate is opened and handshaked on a worker of a bounded pool.
+    *
+    * With at least as many workers as candidates the total time is that of the slowest probe.
+    * A candidate that fails to open or whose handshake throws is not a match, it does not abort the other probes.
+    */
+    class EXQUDENS_SERIAL_EXPORT PortProbe {
+
+        public:
+
+            struct Match {
+                std::string port;       //!< A port address.
+                std::string identity;   //!< A device identity returned by the handshake.
+            };
+
+            using Handshake = std::function<std::optional<std::string>(
+                ISerial& serial,        //!< An open candidate port.
+                const PortInfo& port    //!< A candidate description.
+            )>;
+
+            using Opener = std::function<void(
+                ISerial& serial,            //!< A closed port object.
+                const std::string& port     //!< A candidate port address.
+            )>;
+
+            using Factory = std::function<std::shared_ptr<ISerial>()>;
+
+        private:
+
+            size_t workerCount = 0;
+            Opener opener;
+            Factory factory;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit PortProbe(
+                const size_t& workerCount = 16,     //!< A maximal number of candidates probed at once.
+                const unsigned int& timeout = 100,  //!< A read and write timeout in milliseconds used by the default opener.
+                const Opener& opener = {},          //!< Opens a candidate, 'open(port, timeout)' if empty.
+                const Factory& factory = {}         //!< Creates a port object per candidate, 'Serial' if empty.
+            );
+
+            /*!
+            * Probes the given candidates.
+            *
+            * @return A matches in the order of the candidates.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<Match> probePorts(
+                const PortList& ports,          //!< A candidates, like the result of 'findPorts'.
+                const Handshake& handshake      //!< Returns a device identity or nothing if the device is not recognized.
+            );
+
+            /*!
+            * Probes every port available on the system.
+            *
+            * @return A matches in the order of 'findPorts'.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<Match> probePorts(
+                const Handshake& handshake //!< Returns a device identity or nothing if the device is not recognized.
+            );
+
+    };
+
+}
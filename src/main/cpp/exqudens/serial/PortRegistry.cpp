@@ -0,0 +1,216 @@
+/*!
+* @file PortRegistry.cpp
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <serial/serial.h>
+
+#include "exqudens/serial/PortRegistry.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    namespace {
+
+        PortList listPorts() {
+            PortList result;
+            for (const serial::PortInfo& value : serial::list_ports()) {
+                result.add(value.port, value.description, value.hardware_id);
+            }
+            return result;
+        }
+
+    }
+
+    PortRegistry::PortRegistry(
+        const std::string& directory,
+        const std::function<PortList()>& enumerator
+    ): directory(directory), enumerator(enumerator ? enumerator : listPorts) {
+        try {
+            inotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (inotifyHandle < 0) {
+                throw std::system_error(errno, std::generic_category(), "inotify_init1");
+            }
+            if (inotify_add_watch(inotifyHandle, directory.c_str(), IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO) < 0) {
+                throw std::system_error(errno, std::generic_category(), "inotify_add_watch");
+            }
+            wakeHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wakeHandle < 0) {
+                throw std::system_error(errno, std::generic_category(), "eventfd");
+            }
+            snapshot = std::make_shared<const PortList>();
+            update({}, true);
+            thread = std::thread(&PortRegistry::run, this);
+        } catch (...) {
+            if (wakeHandle >= 0) {
+                ::close(wakeHandle);
+            }
+            if (inotifyHandle >= 0) {
+                ::close(inotifyHandle);
+            }
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    PortRegistry::Snapshot PortRegistry::getSnapshot() {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        return snapshot;
+    }
+
+    size_t PortRegistry::subscribe(const Listener& listener) {
+        try {
+            if (!listener) {
+                throw std::invalid_argument("listener");
+            }
+            std::lock_guard<std::mutex> lock(listenersMutex);
+            size_t id = nextListenerId++;
+            listeners.emplace(id, listener);
+            return id;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PortRegistry::unsubscribe(const size_t& id) {
+        std::lock_guard<std::mutex> lock(listenersMutex);
+        listeners.erase(id);
+    }
+
+    void PortRegistry::refresh() {
+        try {
+            update({}, true);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t PortRegistry::getEnumerationCount() {
+        std::lock_guard<std::mutex> lock(updateMutex);
+        return enumerationCount;
+    }
+
+    PortRegistry::~PortRegistry() noexcept {
+        if (thread.joinable()) {
+            uint64_t value = 1;
+            ssize_t ignored = ::write(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+            thread.join();
+        }
+        if (wakeHandle >= 0) {
+            ::close(wakeHandle);
+        }
+        if (inotifyHandle >= 0) {
+            ::close(inotifyHandle);
+        }
+    }
+
+    bool PortRegistry::isPortName(std::string_view value) {
+        return value.starts_with("tty") || value.starts_with("cu.") || value.starts_with("rfcomm");
+    }
+
+    void PortRegistry::run() {
+        alignas(inotify_event) char buffer[4096];
+        while (true) {
+            pollfd entries[2] = {{inotifyHandle, POLLIN, 0}, {wakeHandle, POLLIN, 0}};
+            if (::poll(entries, 2, -1) < 0 && errno != EINTR) {
+                return;
+            }
+            if ((entries[1].revents & POLLIN) != 0) {
+                return;
+            }
+            if ((entries[0].revents & POLLIN) == 0) {
+                continue;
+            }
+            std::vector<std::string> removedPorts;
+            bool created = false;
+            ssize_t length = 0;
+            while ((length = ::read(inotifyHandle, buffer, sizeof(buffer))) > 0) {
+                for (ssize_t offset = 0; offset < length; ) {
+                    const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                    if ((event->mask & IN_Q_OVERFLOW) != 0) {
+                        // Events were dropped, only a full enumeration catches up with them.
+                        created = true;
+                        continue;
+                    }
+                    if (event->len == 0 || !isPortName(event->name)) {
+                        continue;
+                    }
+                    if ((event->mask & (IN_DELETE | IN_MOVED_FROM)) != 0) {
+                        removedPorts.emplace_back(directory + "/" + event->name);
+                    } else {
+                        created = true;
+                    }
+                }
+            }
+            try {
+                if (created || !removedPorts.empty()) {
+                    update(removedPorts, created);
+                }
+            } catch (...) {
+                // A failed enumeration keeps the previous snapshot, the next event or 'refresh' retries it.
+            }
+        }
+    }
+
+    void PortRegistry::update(const std::vector<std::string>& removedPorts, const bool& enumerate) {
+        try {
+            std::lock_guard<std::mutex> lock(updateMutex);
+            Snapshot current = getSnapshot();
+            PortList ports;
+            if (enumerate) {
+                ports = enumerator();
+                enumerationCount++;
+            } else {
+                for (const PortInfo& port : *current) {
+                    if (std::ranges::find(removedPorts, port.port) == removedPorts.end()) {
+                        ports.add(port.port, port.description, port.hardwareId);
+                    }
+                }
+            }
+
+            std::vector<PortInfo> added;
+            for (const PortInfo& port : ports) {
+                if (std::ranges::find(*current, port) == current->end()) {
+                    added.emplace_back(port);
+                }
+            }
+            std::vector<PortInfo> removed;
+            for (const PortInfo& port : *current) {
+                if (std::ranges::find(ports, port) == ports.end()) {
+                    removed.emplace_back(port);
+                }
+            }
+            if (added.empty() && removed.empty()) {
+                return;
+            }
+
+            Snapshot next = std::make_shared<const PortList>(std::move(ports));
+            {
+                std::lock_guard<std::mutex> snapshotLock(snapshotMutex);
+                snapshot = next;
+            }
+            std::lock_guard<std::mutex> listenersLock(listenersMutex);
+            for (const auto& [id, listener] : listeners) {
+                listener(next, added, removed);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+}
+
+#undef CALL_INFO
@@ -0,0 +1,131 @@
+/*!
+* @file PortRegistry.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/PortList.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Cached port list kept up to date from inotify events on the device directory (Linux only).
+    *
+    * Reading the snapshot does not enumerate ports. Removed device nodes are dropped from the snapshot directly,
+    * created ones trigger one full enumeration per event batch that replaces the snapshot, listeners get the difference.
+    * Listeners are called on the registry thread, or on the thread calling 'refresh', and must not subscribe or unsubscribe.
+    */
+    class EXQUDENS_SERIAL_EXPORT PortRegistry {
+
+        public:
+
+            using Snapshot = std::shared_ptr<const PortList>;
+
+            using Listener = std::function<void(
+                const Snapshot& snapshot,               //!< A snapshot after the change.
+                const std::vector<PortInfo>& added,     //!< A ports added by the change, valid during the call.
+                const std::vector<PortInfo>& removed    //!< A ports removed by the change, valid during the call.
+            )>;
+
+        private:
+
+            std::string directory;
+            std::function<PortList()> enumerator;
+            int inotifyHandle = -1;
+            int wakeHandle = -1;
+            std::mutex snapshotMutex;
+            Snapshot snapshot = nullptr;
+            std::mutex updateMutex;
+            std::mutex listenersMutex;
+            std::map<size_t, Listener> listeners;
+            size_t nextListenerId = 1;
+            size_t enumerationCount = 0;
+            std::thread thread;
+
+        public:
+
+            /*!
+            * Constructor, enumerates ports once and starts watching the directory.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit PortRegistry(
+                const std::string& directory = "/dev",                              //!< A directory holding the device nodes.
+                const std::function<PortList()>& enumerator = {}                    //!< A full enumeration, 'serial::list_ports' if empty.
+            );
+
+            PortRegistry(const PortRegistry&) = delete;
+
+            PortRegistry& operator=(const PortRegistry&) = delete;
+
+            /*!
+            * Gets the current snapshot.
+            *
+            * @return A snapshot that stays valid and unchanged while it is held.
+            */
+            EXQUDENS_SERIAL_INLINE
+            Snapshot getSnapshot();
+
+            /*!
+            * Subscribes to snapshot changes.
+            *
+            * @return A subscription id.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t subscribe(
+                const Listener& listener //!< A listener called after every change.
+            );
+
+            /*!
+            * Unsubscribes from snapshot changes, does nothing for an unknown id.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void unsubscribe(
+                const size_t& id //!< A subscription id.
+            );
+
+            /*!
+            * Enumerates ports now and replaces the snapshot, listeners are called if it changed.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void refresh();
+
+            /*!
+            * Gets the number of full enumerations done so far.
+            *
+            * @return A number of enumerations.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getEnumerationCount();
+
+            /*!
+            * Destructor.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~PortRegistry() noexcept;
+
+        private:
+
+            static bool isPortName(std::string_view value);
+
+            void run();
+
+            void update(const std::vector<std::string>& removedPorts, const bool& enumerate);
+
+    };
+
+}
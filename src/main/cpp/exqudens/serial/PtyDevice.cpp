@@ -0,0 +1,421 @@
+/*!
+* @file PtyDevice.cpp
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Journal.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define BLOCK_SIZE 4096
+#define OUTPUT_LIMIT 65536
+
+namespace exqudens {
+
+    PtyDevice::PtyDevice() {
+        try {
+            master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+            if (master < 0) {
+                throw std::system_error(errno, std::generic_category(), "posix_openpt");
+            }
+            char name[256] = {};
+            if (grantpt(master) != 0 || unlockpt(master) != 0 || ptsname_r(master, name, sizeof(name)) != 0) {
+                int error = errno;
+                ::close(master);
+                throw std::system_error(error, std::generic_category(), "grantpt/unlockpt/ptsname_r");
+            }
+            slavePath = name;
+            termios attributes = {};
+            if (tcgetattr(master, &attributes) == 0) {
+                cfmakeraw(&attributes);
+                tcsetattr(master, TCSANOW, &attributes);
+            }
+            wakeHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wakeHandle < 0) {
+                int error = errno;
+                ::close(master);
+                throw std::system_error(error, std::generic_category(), "eventfd");
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::string PtyDevice::getSlavePath() const {
+        return slavePath;
+    }
+
+    int PtyDevice::getMasterHandle() const {
+        return master;
+    }
+
+    size_t PtyDevice::write(const std::vector<unsigned char>& bytes) {
+        try {
+            size_t result = 0;
+            while (result < bytes.size()) {
+                ssize_t length = ::write(master, bytes.data() + result, bytes.size() - result);
+                if (length > 0) {
+                    result += static_cast<size_t>(length);
+                } else if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "write");
+                } else {
+                    pollfd entry = {master, POLLOUT, 0};
+                    ::poll(&entry, 1, 100);
+                }
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<unsigned char> PtyDevice::read(const size_t& size, const int& timeoutMs) {
+        try {
+            std::vector<unsigned char> result(size);
+            size_t offset = 0;
+            while (offset < size) {
+                pollfd entry = {master, POLLIN, 0};
+                if (::poll(&entry, 1, timeoutMs) <= 0) {
+                    break;
+                }
+                ssize_t length = ::read(master, result.data() + offset, size - offset);
+                if (length > 0) {
+                    offset += static_cast<size_t>(length);
+                } else if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                    break;
+                }
+            }
+            result.resize(offset);
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startEcho() {
+        try {
+            start(Mode::LOOPBACK);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startUppercase() {
+        try {
+            start(Mode::UPPERCASE);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startDelayedEcho(const std::chrono::microseconds& delay) {
+        try {
+            if (delay.count() < 0) {
+                throw std::invalid_argument("delay");
+            }
+            if (thread.joinable()) {
+                throw std::runtime_error("behaviour is already running");
+            }
+            echoDelay = delay;
+            start(Mode::DELAYED_LOOPBACK);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startStream(const std::vector<unsigned char>& pattern, const size_t& bytesPerSecond) {
+        try {
+            if (pattern.empty()) {
+                throw std::invalid_argument("pattern");
+            }
+            if (thread.joinable()) {
+                throw std::runtime_error("behaviour is already running");
+            }
+            streamPattern = pattern;
+            streamRate = bytesPerSecond;
+            start(Mode::STREAM);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startScript(const std::vector<Exchange>& exchanges) {
+        try {
+            if (thread.joinable()) {
+                throw std::runtime_error("behaviour is already running");
+            }
+            scriptExchanges = exchanges;
+            start(Mode::SCRIPT);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::startReplay(const std::string& path, const double& speed) {
+        try {
+            if (speed < 0) {
+                throw std::invalid_argument("speed");
+            }
+            if (thread.joinable()) {
+                throw std::runtime_error("behaviour is already running");
+            }
+            replayRecords.clear();
+            std::optional<std::chrono::nanoseconds> first = {};
+            Journal::read(path, [this, &first](const Journal::Record& record) {
+                if (record.direction != Journal::Direction::READ) {
+                    return;
+                }
+                if (!first) {
+                    first = record.time;
+                }
+                const unsigned char* bytes = reinterpret_cast<const unsigned char*>(record.bytes.data());
+                replayRecords.emplace_back(record.time - first.value(), std::vector<unsigned char>(bytes, bytes + record.bytes.size()));
+            });
+            replaySpeed = speed;
+            start(Mode::REPLAY);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::stop() {
+        try {
+            if (!thread.joinable()) {
+                return;
+            }
+            uint64_t value = 1;
+            if (::write(wakeHandle, &value, sizeof(value)) < 0) {
+                throw std::system_error(errno, std::generic_category(), "eventfd write");
+            }
+            thread.join();
+            ssize_t ignored = ::read(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+            if (threadException) {
+                std::exception_ptr exception = threadException;
+                threadException = nullptr;
+                std::rethrow_exception(exception);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool PtyDevice::isRunning() const {
+        return thread.joinable();
+    }
+
+    size_t PtyDevice::getReceivedCount() const {
+        return receivedCount.load(std::memory_order_relaxed);
+    }
+
+    size_t PtyDevice::getSentCount() const {
+        return sentCount.load(std::memory_order_relaxed);
+    }
+
+    PtyDevice::~PtyDevice() noexcept {
+        if (thread.joinable()) {
+            uint64_t value = 1;
+            ssize_t ignored = ::write(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+            thread.join();
+        }
+        if (wakeHandle >= 0) {
+            ::close(wakeHandle);
+        }
+        if (master >= 0) {
+            ::close(master);
+        }
+    }
+
+    void PtyDevice::start(const Mode& value) {
+        try {
+            if (thread.joinable()) {
+                throw std::runtime_error("behaviour is already running");
+            }
+            mode = value;
+            receivedCount.store(0, std::memory_order_relaxed);
+            sentCount.store(0, std::memory_order_relaxed);
+            thread = std::thread(&PtyDevice::run, this);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void PtyDevice::run() {
+        try {
+            std::vector<unsigned char> input(BLOCK_SIZE);
+            std::vector<unsigned char> output;
+            size_t outputBegin = 0;
+            std::vector<unsigned char> script;
+            size_t scriptLimit = 0;
+            for (const Exchange& exchange : scriptExchanges) {
+                scriptLimit = std::max(scriptLimit, exchange.request.size());
+            }
+            size_t streamOffset = 0;
+            size_t streamed = 0;
+            std::chrono::steady_clock::time_point streamStart = std::chrono::steady_clock::now();
+            size_t replayIndex = 0;
+            std::deque<std::pair<std::chrono::steady_clock::time_point, std::vector<unsigned char>>> delayed;
+
+            while (true) {
+                int timeout = -1;
+                if (mode == Mode::STREAM && outputBegin == output.size()) {
+                    output.clear();
+                    outputBegin = 0;
+                    size_t due = BLOCK_SIZE;
+                    if (streamRate > 0) {
+                        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - streamStart).count();
+                        size_t total = static_cast<size_t>(elapsed * static_cast<double>(streamRate));
+                        due = std::min<size_t>(total > streamed ? total - streamed : 0, BLOCK_SIZE);
+                    }
+                    for (size_t i = 0; i < due; i++) {
+                        output.emplace_back(streamPattern.at(streamOffset));
+                        streamOffset = (streamOffset + 1) % streamPattern.size();
+                    }
+                    streamed += due;
+                    if (output.empty()) {
+                        double next = static_cast<double>(streamed + 1) / static_cast<double>(streamRate);
+                        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - streamStart).count();
+                        timeout = std::max(1, static_cast<int>((next - elapsed) * 1000.0 + 0.999));
+                    }
+                }
+
+                if (mode == Mode::REPLAY && outputBegin == output.size()) {
+                    output.clear();
+                    outputBegin = 0;
+                    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - streamStart;
+                    while (replayIndex < replayRecords.size() && output.size() < OUTPUT_LIMIT) {
+                        std::chrono::nanoseconds due(0);
+                        if (replaySpeed > 0) {
+                            due = std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(replayRecords.at(replayIndex).first.count()) / replaySpeed));
+                        }
+                        if (due > elapsed) {
+                            if (output.empty()) {
+                                timeout = std::max(1, static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(due - elapsed).count()));
+                            }
+                            break;
+                        }
+                        output.insert(output.end(), replayRecords.at(replayIndex).second.begin(), replayRecords.at(replayIndex).second.end());
+                        replayIndex++;
+                    }
+                }
+
+                if (mode == Mode::DELAYED_LOOPBACK && outputBegin == output.size()) {
+                    output.clear();
+                    outputBegin = 0;
+                    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                    while (!delayed.empty() && delayed.front().first <= now && output.size() < OUTPUT_LIMIT) {
+                        output.insert(output.end(), delayed.front().second.begin(), delayed.front().second.end());
+                        delayed.pop_front();
+                    }
+                    if (output.empty() && !delayed.empty()) {
+                        timeout = std::max(1, static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(delayed.front().first - now).count()));
+                    }
+                }
+
+                short events = 0;
+                if (output.size() - outputBegin < OUTPUT_LIMIT) {
+                    events |= POLLIN;
+                }
+                if (outputBegin < output.size()) {
+                    events |= POLLOUT;
+                }
+                pollfd entries[2] = {{master, events, 0}, {wakeHandle, POLLIN, 0}};
+                if (::poll(entries, 2, timeout) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "poll");
+                }
+                if ((entries[1].revents & POLLIN) != 0) {
+                    return;
+                }
+                if ((entries[0].revents & POLLHUP) != 0 && (entries[0].revents & POLLIN) == 0) {
+                    // No slave is open, wait for one without spinning on the hang-up.
+                    pollfd entry = {wakeHandle, POLLIN, 0};
+                    if (::poll(&entry, 1, 10) > 0) {
+                        return;
+                    }
+                    continue;
+                }
+
+                if ((entries[0].revents & POLLIN) != 0) {
+                    ssize_t length = ::read(master, input.data(), input.size());
+                    if (length < 0 && errno != EAGAIN && errno != EINTR && errno != EIO) {
+                        throw std::system_error(errno, std::generic_category(), "read");
+                    }
+                    if (mode == Mode::DELAYED_LOOPBACK && length > 0) {
+                        delayed.emplace_back(std::chrono::steady_clock::now() + echoDelay, std::vector<unsigned char>(input.begin(), input.begin() + length));
+                    }
+                    for (ssize_t i = 0; i < length; i++) {
+                        unsigned char value = input.at(static_cast<size_t>(i));
+                        if (mode == Mode::LOOPBACK) {
+                            output.emplace_back(value);
+                        } else if (mode == Mode::UPPERCASE) {
+                            output.emplace_back(static_cast<unsigned char>(std::toupper(value)));
+                        } else if (mode == Mode::SCRIPT) {
+                            script.emplace_back(value);
+                            for (const Exchange& exchange : scriptExchanges) {
+                                if (!exchange.request.empty()
+                                    && script.size() >= exchange.request.size()
+                                    && std::equal(exchange.request.begin(), exchange.request.end(), script.end() - static_cast<std::ptrdiff_t>(exchange.request.size()))) {
+                                    output.insert(output.end(), exchange.response.begin(), exchange.response.end());
+                                    script.clear();
+                                    break;
+                                }
+                            }
+                            if (script.size() > scriptLimit) {
+                                script.erase(script.begin(), script.end() - static_cast<std::ptrdiff_t>(scriptLimit));
+                            }
+                        }
+                    }
+                    if (length > 0) {
+                        receivedCount.fetch_add(static_cast<size_t>(length), std::memory_order_relaxed);
+                    }
+                }
+
+                if (outputBegin < output.size()) {
+                    ssize_t length = ::write(master, output.data() + outputBegin, output.size() - outputBegin);
+                    if (length > 0) {
+                        outputBegin += static_cast<size_t>(length);
+                        sentCount.fetch_add(static_cast<size_t>(length), std::memory_order_relaxed);
+                    } else if (length < 0 && errno != EAGAIN && errno != EINTR && errno != EIO) {
+                        throw std::system_error(errno, std::generic_category(), "write");
+                    }
+                    if (outputBegin == output.size()) {
+                        output.clear();
+                        outputBegin = 0;
+                    }
+                }
+            }
+        } catch (...) {
+            try {
+                std::throw_with_nested(std::runtime_error(CALL_INFO));
+            } catch (...) {
+                threadException = std::current_exception();
+            }
+        }
+    }
+
+}
+
+#undef CALL_INFO
+#undef BLOCK_SIZE
+#undef OUTPUT_LIMIT
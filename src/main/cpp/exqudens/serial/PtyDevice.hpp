@@ -0,0 +1,227 @@
+/*!
+* @file PtyDevice.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Pseudo-terminal pair that plays a device on the master side for tests and benchmarks without hardware (Linux only).
+    *
+    * The slave path is opened like any serial port, for example with 'Serial::open'.
+    * A behaviour started with one of the 'start' functions runs on its own thread until 'stop',
+    * while no behaviour runs the master side can be driven directly with 'write' and 'read'.
+    */
+    class EXQUDENS_SERIAL_EXPORT PtyDevice {
+
+        public:
+
+            struct Exchange {
+                std::vector<unsigned char> request;     //!< A bytes that trigger the response when received.
+                std::vector<unsigned char> response;    //!< A bytes sent back.
+            };
+
+        private:
+
+            enum class Mode {
+                LOOPBACK,
+                UPPERCASE,
+                STREAM,
+                SCRIPT,
+                REPLAY,
+                DELAYED_LOOPBACK
+            };
+
+            int master = -1;
+            int wakeHandle = -1;
+            std::string slavePath;
+            Mode mode = Mode::LOOPBACK;
+            std::vector<unsigned char> streamPattern;
+            size_t streamRate = 0;
+            std::vector<Exchange> scriptExchanges;
+            std::vector<std::pair<std::chrono::nanoseconds, std::vector<unsigned char>>> replayRecords;
+            double replaySpeed = 1;
+            std::chrono::microseconds echoDelay = std::chrono::microseconds(0);
+            std::thread thread;
+            std::exception_ptr threadException = nullptr;
+            std::atomic<size_t> receivedCount = 0;
+            std::atomic<size_t> sentCount = 0;
+
+        public:
+
+            /*!
+            * Constructor, creates the pair in raw mode.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            PtyDevice();
+
+            PtyDevice(const PtyDevice&) = delete;
+
+            PtyDevice& operator=(const PtyDevice&) = delete;
+
+            /*!
+            * Gets the slave path.
+            *
+            * @return A path to be opened as a serial port.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::string getSlavePath() const;
+
+            /*!
+            * Gets the non-blocking master handle.
+            *
+            * @return A file descriptor.
+            */
+            EXQUDENS_SERIAL_INLINE
+            int getMasterHandle() const;
+
+            /*!
+            * Writes all bytes to the master side, waiting while the pty buffer is full.
+            * Must not be used while a behaviour is running.
+            *
+            * @return A number of bytes written.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t write(
+                const std::vector<unsigned char>& bytes //!< A data to be written.
+            );
+
+            /*!
+            * Reads from the master side until 'size' bytes arrived or no byte arrived within the timeout.
+            * Must not be used while a behaviour is running.
+            *
+            * @return A bytes read.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::vector<unsigned char> read(
+                const size_t& size,     //!< A maximum number of bytes to be read.
+                const int& timeoutMs    //!< A timeout in milliseconds between bytes.
+            );
+
+            /*!
+            * Starts sending back every received byte.
+            *
+            * @throws std::runtime_error if a behaviour is already running.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startEcho();
+
+            /*!
+            * Starts sending back every received byte in upper case.
+            *
+            * @throws std::runtime_error if a behaviour is already running.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startUppercase();
+
+            /*!
+            * Starts sending back every received byte after a fixed delay, like a device that takes time to process
+            * a command but accepts the next ones meanwhile. Bytes keep their order, delays of consecutive reads overlap.
+            *
+            * @throws std::runtime_error if a behaviour is already running.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startDelayedEcho(
+                const std::chrono::microseconds& delay //!< A time between receiving a byte and sending it back.
+            );
+
+            /*!
+            * Starts sending the pattern repeatedly at a fixed rate, received bytes are discarded.
+            *
+            * @throws std::runtime_error if a behaviour is already running or the pattern is empty.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startStream(
+                const std::vector<unsigned char>& pattern,  //!< A bytes to be sent in a loop.
+                const size_t& bytesPerSecond                //!< A rate, @b 0 sends as fast as the reader drains.
+            );
+
+            /*!
+            * Starts answering requests, when the received bytes end with a request of an exchange its response is sent
+            * and the received bytes are forgotten. Exchanges are checked in order, bytes matching none are kept.
+            *
+            * @throws std::runtime_error if a behaviour is already running.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startScript(
+                const std::vector<Exchange>& exchanges //!< A request and response pairs.
+            );
+
+            /*!
+            * Starts sending the bytes of the 'Journal::Direction::READ' records of a journal segment,
+            * keeping their recorded spacing divided by the speed, received bytes are discarded.
+            * The behaviour keeps running after the last record until 'stop'.
+            *
+            * @throws std::runtime_error if a behaviour is already running or the journal can not be read.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void startReplay(
+                const std::string& path,    //!< A journal segment file path.
+                const double& speed = 1     //!< A speed factor, @b 1 replays in original time, @b 0 as fast as possible.
+            );
+
+            /*!
+            * Stops the running behaviour, does nothing if none runs.
+            *
+            * @throws std::runtime_error with the nested behaviour failure if the behaviour thread failed.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void stop();
+
+            /*!
+            * Gets the behaviour status.
+            *
+            * @return @b true if a behaviour is running, @b false otherwise.
+            */
+            EXQUDENS_SERIAL_INLINE
+            bool isRunning() const;
+
+            /*!
+            * Gets the number of bytes the running or last behaviour received from the slave side.
+            *
+            * @return A number of bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getReceivedCount() const;
+
+            /*!
+            * Gets the number of bytes the running or last behaviour sent to the slave side.
+            *
+            * @return A number of bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getSentCount() const;
+
+            /*!
+            * Destructor.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~PtyDevice() noexcept;
+
+        private:
+
+            void start(const Mode& value);
+
+            void run();
+
+    };
+
+}
@@ -0,0 +1,113 @@
+/*!
+* @file RingBuffer.cpp
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include "exqudens/serial/RingBuffer.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    RingBuffer::RingBuffer(const size_t& capacity) {
+        try {
+            if (capacity == 0) {
+                throw std::invalid_argument("capacity");
+            }
+            this->capacity = std::bit_ceil(capacity);
+            this->mask = this->capacity - 1;
+            this->data = std::make_unique<std::byte[]>(this->capacity);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t RingBuffer::getCapacity() const {
+        return capacity;
+    }
+
+    size_t RingBuffer::size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    std::span<std::byte> RingBuffer::writableRegion() {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t t = tail.load(std::memory_order_acquire);
+        size_t free = capacity - (h - t);
+        size_t offset = h & mask;
+        return {data.get() + offset, std::min(free, capacity - offset)};
+    }
+
+    void RingBuffer::commitWrite(const size_t& length) {
+        size_t h = head.load(std::memory_order_relaxed) + length;
+        head.store(h, std::memory_order_release);
+        size_t used = h - tail.load(std::memory_order_acquire);
+        if (used > highWaterMark.load(std::memory_order_relaxed)) {
+            highWaterMark.store(used, std::memory_order_relaxed);
+        }
+    }
+
+    size_t RingBuffer::write(std::span<const std::byte> bytes) {
+        size_t result = 0;
+        while (result < bytes.size()) {
+            std::span<std::byte> region = writableRegion();
+            if (region.empty()) {
+                break;
+            }
+            size_t length = std::min(region.size(), bytes.size() - result);
+            std::memcpy(region.data(), bytes.data() + result, length);
+            commitWrite(length);
+            result += length;
+        }
+        if (result < bytes.size()) {
+            addOverflow(bytes.size() - result);
+        }
+        return result;
+    }
+
+    void RingBuffer::addOverflow(const size_t& length) {
+        overflowCount.fetch_add(length, std::memory_order_relaxed);
+    }
+
+    std::span<const std::byte> RingBuffer::readableRegion() const {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        size_t offset = t & mask;
+        return {data.get() + offset, std::min(h - t, capacity - offset)};
+    }
+
+    void RingBuffer::commitRead(const size_t& length) {
+        tail.store(tail.load(std::memory_order_relaxed) + length, std::memory_order_release);
+    }
+
+    size_t RingBuffer::read(std::span<std::byte> bytes) {
+        size_t result = 0;
+        while (result < bytes.size()) {
+            std::span<const std::byte> region = readableRegion();
+            if (region.empty()) {
+                break;
+            }
+            size_t length = std::min(region.size(), bytes.size() - result);
+            std::memcpy(bytes.data() + result, region.data(), length);
+            commitRead(length);
+            result += length;
+        }
+        return result;
+    }
+
+    size_t RingBuffer::getOverflowCount() const {
+        return overflowCount.load(std::memory_order_relaxed);
+    }
+
+    size_t RingBuffer::getHighWaterMark() const {
+        return highWaterMark.load(std::memory_order_relaxed);
+    }
+
+}
+
+#undef CALL_INFO
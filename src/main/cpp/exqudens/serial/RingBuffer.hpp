@@ -0,0 +1,144 @@
+/*!
+* @file RingBuffer.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Lock-free single-producer/single-consumer byte ring buffer with preallocated storage.
+    *
+    * Exactly one thread may call the producer functions (writableRegion, commitWrite, write, addOverflow)
+    * and exactly one other thread may call the consumer functions (readableRegion, commitRead, read).
+    */
+    class EXQUDENS_SERIAL_EXPORT RingBuffer {
+
+        private:
+
+            std::unique_ptr<std::byte[]> data = nullptr;
+            size_t capacity = 0;
+            size_t mask = 0;
+            alignas(64) std::atomic<size_t> head = 0;
+            alignas(64) std::atomic<size_t> tail = 0;
+            alignas(64) std::atomic<size_t> overflowCount = 0;
+            std::atomic<size_t> highWaterMark = 0;
+
+        public:
+
+            /*!
+            * Constructor.
+            *
+            * @throws std::invalid_argument if capacity is zero.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit RingBuffer(
+                const size_t& capacity //!< A minimal capacity in bytes, rounded up to the next power of two.
+            );
+
+            RingBuffer(const RingBuffer&) = delete;
+
+            RingBuffer& operator=(const RingBuffer&) = delete;
+
+            /*!
+            * Gets capacity.
+            *
+            * @return A capacity in bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getCapacity() const;
+
+            /*!
+            * Gets number of bytes available for reading.
+            *
+            * @return A number of buffered bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t size() const;
+
+            /*!
+            * Gets contiguous free region the producer may fill, may be shorter than total free space on wrap around.
+            *
+            * @return A writable view, empty if the buffer is full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::span<std::byte> writableRegion();
+
+            /*!
+            * Publishes bytes filled in the region returned by 'writableRegion'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void commitWrite(
+                const size_t& length //!< A number of bytes filled.
+            );
+
+            /*!
+            * Copies bytes into the buffer, bytes that do not fit are counted as overflow.
+            *
+            * @return A number of bytes actually stored.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t write(
+                std::span<const std::byte> bytes //!< A bytes to store.
+            );
+
+            /*!
+            * Counts bytes dropped by the producer because the buffer was full.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void addOverflow(
+                const size_t& length //!< A number of dropped bytes.
+            );
+
+            /*!
+            * Gets contiguous readable region, may be shorter than 'size' on wrap around.
+            *
+            * @return A readable view, empty if the buffer is empty.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::span<const std::byte> readableRegion() const;
+
+            /*!
+            * Releases bytes consumed from the region returned by 'readableRegion'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void commitRead(
+                const size_t& length //!< A number of bytes consumed.
+            );
+
+            /*!
+            * Copies buffered bytes into the caller buffer.
+            *
+            * @return A number of bytes actually copied.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t read(
+                std::span<std::byte> bytes //!< A buffer to be filled.
+            );
+
+            /*!
+            * Gets number of bytes dropped because the buffer was full.
+            *
+            * @return An overflow count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getOverflowCount() const;
+
+            /*!
+            * Gets maximal number of bytes ever buffered at once.
+            *
+            * @return A high-water mark.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getHighWaterMark() const;
+
+    };
+
+}
@@ -2,23 +2,68 @@
 * @file Serial.cpp
 */
 
-#include <cctype>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <limits>
 #include <filesystem>
 #include <memory>
 #include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 
 #include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
 #include "exqudens/serial/versions.hpp"
 
+#if defined(__linux__)
+#include "exqudens/serial/Termios2.hpp"
+#endif
+
 #define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
 #define LOGGER_ID "exqudens.Serial"
 #define LOGGER_LEVEL_ERROR 2
 #define LOGGER_LEVEL_DEBUG 5
+#if !defined(EXQUDENS_SERIAL_LOG_LEVEL)
+#if defined(NDEBUG)
+#define EXQUDENS_SERIAL_LOG_LEVEL 4
+#else
+#define EXQUDENS_SERIAL_LOG_LEVEL 6
+#endif
+#endif
+#define LOG(level, message) do { if constexpr ((level) <= EXQUDENS_SERIAL_LOG_LEVEL) { if (isLogEnabled(level)) { log(__FILE__, __LINE__, __FUNCTION__, LOGGER_ID, level, message); } } } while (false)
+#define LOG_E(message) LOG(LOGGER_LEVEL_ERROR, message)
+#define LOG_D(message) LOG(LOGGER_LEVEL_DEBUG, message)
 
 namespace exqudens {
 
-    Serial::Serial(const bool& autoClose): autoClose(autoClose) {}
+    Serial::Serial(const bool& autoClose, const bool& ioUring): autoClose(autoClose) {
+#if defined(__linux__)
+        try {
+            if (ioUring && IoUring::isSupported()) {
+                this->ioUring = std::make_unique<IoUring>(8);
+            }
+            wakeHandle = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (wakeHandle < 0) {
+                throw std::system_error(errno, std::generic_category(), "eventfd");
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+#endif
+    }
+
+    Serial::Serial(const bool& autoClose): Serial(autoClose, false) {}
 
     Serial::Serial(): Serial(true) {}
 
@@ -43,6 +88,14 @@ namespace exqudens {
         return (bool) logFunction;
     }
 
+    void Serial::setLogLevel(const unsigned short& value) {
+        logLevel = value;
+    }
+
+    unsigned short Serial::getLogLevel() {
+        return logLevel;
+    }
+
     std::string Serial::getVersion() {
         return std::to_string(PROJECT_VERSION_MAJOR) + "." + std::to_string(PROJECT_VERSION_MINOR) + "." + std::to_string(PROJECT_VERSION_PATCH);
     }
@@ -50,21 +103,40 @@ namespace exqudens {
     std::vector<std::map<std::string, std::string>> Serial::listPorts() {
         try {
             std::vector<std::map<std::string, std::string>> results;
+            for (const PortInfo& port : findPorts()) {
+                results.emplace_back(std::map<std::string, std::string> {
+                    {"port", std::string(port.port)},
+                    {"description", std::string(port.description)},
+                    {"hardware-id", std::string(port.hardwareId)}
+                });
+            }
+            return results;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    PortList Serial::findPorts(const PortList::Predicate& predicate) {
+        try {
             std::vector<serial::PortInfo> portInfos = serial::list_ports();
 
+            size_t bytes = 0;
             for (const serial::PortInfo& portInfo : portInfos) {
-                std::map<std::string, std::string> result = toMap(portInfo);
+                bytes += portInfo.port.size() + portInfo.description.size() + portInfo.hardware_id.size();
+            }
+            PortList results;
+            results.reserve(portInfos.size(), bytes);
 
-                if (logFunction) {
-                    std::string message = "{";
-                    message += "\"port\": \"" + result.at("port") + "\", ";
-                    message += "\"description\": \"" + result.at("description") + "\", ";
-                    message += "\"hardware-id\": \"" + result.at("hardware-id") + "\"";
-                    message += "}";
-                    log(__FILE__, __LINE__, __FUNCTION__, LOGGER_ID, LOGGER_LEVEL_DEBUG, message);
+            for (const serial::PortInfo& portInfo : portInfos) {
+                if (!results.add(portInfo.port, portInfo.description, portInfo.hardware_id, predicate)) {
+                    continue;
                 }
-
-                results.emplace_back(result);
+                const PortInfo& result = results.at(results.size() - 1);
+                LOG_D(
+                    "{\"port\": \"" + std::string(result.port) + "\", "
+                    "\"description\": \"" + std::string(result.description) + "\", "
+                    "\"hardware-id\": \"" + std::string(result.hardwareId) + "\"}"
+                );
             }
 
             return results;
@@ -73,6 +145,31 @@ namespace exqudens {
         }
     }
 
+    PortList Serial::findPorts(const uint16_t& vendorId, const uint16_t& productId) {
+        try {
+            return findPorts([&vendorId, &productId](const PortInfo& port) {
+                return port.vendorId == vendorId && port.productId == productId;
+            });
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    PortList Serial::findPorts(const std::regex& pattern) {
+        try {
+            return findPorts([&pattern](const PortInfo& port) {
+                for (std::string_view value : {port.port, port.description, port.hardwareId}) {
+                    if (std::regex_search(value.begin(), value.end(), pattern)) {
+                        return true;
+                    }
+                }
+                return false;
+            });
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
     void Serial::open(
         const std::string& port,
         const unsigned int& baudRate,
@@ -87,72 +184,36 @@ namespace exqudens {
         const unsigned int& flowControl
     ) {
         try {
-            log(__FILE__, __LINE__, __FUNCTION__, LOGGER_ID, LOGGER_LEVEL_DEBUG, "port: '" + port + "'");
-
-            serial::bytesize_t internalBiteSize = serial::eightbits;
-
-            if (biteSize == 8) {
-                internalBiteSize = serial::eightbits;
-            } else if (biteSize == 7) {
-                internalBiteSize = serial::sevenbits;
-            } else if (biteSize == 6) {
-                internalBiteSize = serial::sixbits;
-            } else if (biteSize == 5) {
-                internalBiteSize = serial::fivebits;
-            } else {
-                throw std::invalid_argument("biteSize");
-            }
-
-            serial::parity_t internalParity = serial::parity_none;
-
-            if (parity == 0) {
-                internalParity = serial::parity_none;
-            } else if (parity == 1) {
-                internalParity = serial::parity_odd;
-            } else if (parity == 2) {
-                internalParity = serial::parity_even;
-            } else {
-                throw std::invalid_argument("parity");
-            }
-
-            serial::stopbits_t internalStopBits = serial::stopbits_one;
-
-            if (stopBits == 0) {
-                internalStopBits = serial::stopbits_one;
-            } else if (stopBits == 1) {
-                internalStopBits = serial::stopbits_one_point_five;
-            } else if (stopBits == 2) {
-                internalStopBits = serial::stopbits_two;
-            } else {
-                throw std::invalid_argument("stopBits");
-            }
-
-            serial::flowcontrol_t internalFlowControl = serial::flowcontrol_none;
-
-            if (flowControl == 0) {
-                internalFlowControl = serial::flowcontrol_none;
-            } else if (flowControl == 1) {
-                internalFlowControl = serial::flowcontrol_software;
-            } else if (flowControl == 2) {
-                internalFlowControl = serial::flowcontrol_hardware;
-            } else {
-                throw std::invalid_argument("flowControl");
+            std::exception_ptr exception = openPort(port, baudRate, timeoutInterByte, timeoutReadConstant, timeoutReadMultiplier, timeoutWriteConstant, timeoutWriteMultiplier, biteSize, parity, stopBits, flowControl);
+            if (exception) {
+                std::rethrow_exception(exception);
             }
-
-            object = std::make_unique<serial::Serial>(
-                port,
-                baudRate,
-                serial::Timeout(timeoutInterByte, timeoutReadConstant, timeoutReadMultiplier, timeoutWriteConstant, timeoutWriteMultiplier),
-                internalBiteSize,
-                internalParity,
-                internalStopBits,
-                internalFlowControl
-            );
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
         }
     }
 
+    void Serial::open(
+        const std::string& port,
+        const unsigned int& baudRate,
+        const unsigned int& timeoutInterByte,
+        const unsigned int& timeoutReadConstant,
+        const unsigned int& timeoutReadMultiplier,
+        const unsigned int& timeoutWriteConstant,
+        const unsigned int& timeoutWriteMultiplier,
+        const unsigned int& biteSize,
+        const unsigned int& parity,
+        const unsigned int& stopBits,
+        const unsigned int& flowControl,
+        std::error_code& error
+    ) noexcept {
+        error.clear();
+        std::exception_ptr exception = openPort(port, baudRate, timeoutInterByte, timeoutReadConstant, timeoutReadMultiplier, timeoutWriteConstant, timeoutWriteMultiplier, biteSize, parity, stopBits, flowControl);
+        if (exception) {
+            error = toErrorCode(exception);
+        }
+    }
+
     void Serial::open(const std::string& port, const unsigned int& timeoutSimple) {
         try {
             open(
@@ -173,6 +234,23 @@ namespace exqudens {
         }
     }
 
+    void Serial::open(const std::string& port, const unsigned int& timeoutSimple, std::error_code& error) noexcept {
+        open(
+            port,
+            9600,
+            serial::Timeout::max(),
+            timeoutSimple,
+            0,
+            timeoutSimple,
+            0,
+            8,
+            0,
+            0,
+            0,
+            error
+        );
+    }
+
     void Serial::open(const std::string& port) {
         try {
             open(
@@ -194,11 +272,162 @@ namespace exqudens {
     }
 
     bool Serial::isOpen() {
+        return opened.load(std::memory_order_acquire);
+    }
+
+    unsigned int Serial::setBaudRate(const unsigned int& baudRate) {
         try {
-            if (object) {
-                return object->isOpen();
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            serial::Serial& value = getOpenObject();
+            bool changed = value.getBaudrate() != baudRate;
+#if defined(__linux__)
+            if (!Termios2::isStandardBaudRate(baudRate)) {
+                if (customBaudRate != baudRate) {
+                    LOG_D("baudRate: " + std::to_string(baudRate));
+                    unsigned int previous = Termios2::getBaudRate(nativeHandle);
+                    unsigned int applied = Termios2::setBaudRate(nativeHandle, baudRate);
+                    if (applied != baudRate) {
+                        // Rejected like in 'open', the port goes back to the rate it had.
+                        Termios2::setBaudRate(nativeHandle, previous);
+                        throw std::system_error(
+                            std::make_error_code(std::errc::invalid_argument),
+                            "baudRate: " + std::to_string(baudRate) + " applied: " + std::to_string(applied)
+                        );
+                    }
+                    customBaudRate = baudRate;
+                    return applied;
+                }
+                return getAppliedBaudRate();
+            }
+            changed = changed || customBaudRate != 0;
+            customBaudRate = 0;
+#endif
+            if (changed) {
+                LOG_D("baudRate: " + std::to_string(baudRate));
+                value.setBaudrate(baudRate);
+            }
+            return getAppliedBaudRate();
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    unsigned int Serial::getBaudRate() {
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            return getAppliedBaudRate();
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<unsigned int> Serial::getAchievableBaudRates(const std::vector<unsigned int>& candidates) {
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+#if defined(__linux__)
+            getOpenObject();
+            return Termios2::getAchievableBaudRates(nativeHandle, candidates);
+#else
+            serial::Serial& value = getOpenObject();
+            uint32_t original = value.getBaudrate();
+            std::vector<unsigned int> results;
+            for (unsigned int candidate : candidates) {
+                try {
+                    value.setBaudrate(candidate);
+                    results.emplace_back(value.getBaudrate());
+                } catch (...) {
+                    results.emplace_back(0);
+                }
+            }
+            value.setBaudrate(original);
+            return results;
+#endif
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::setTimeouts(
+        const unsigned int& timeoutInterByte,
+        const unsigned int& timeoutReadConstant,
+        const unsigned int& timeoutReadMultiplier,
+        const unsigned int& timeoutWriteConstant,
+        const unsigned int& timeoutWriteMultiplier
+    ) {
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            serial::Serial& value = getOpenObject();
+            serial::Timeout current = value.getTimeout();
+            serial::Timeout timeout(timeoutInterByte, timeoutReadConstant, timeoutReadMultiplier, timeoutWriteConstant, timeoutWriteMultiplier);
+            if (
+                current.inter_byte_timeout != timeout.inter_byte_timeout
+                || current.read_timeout_constant != timeout.read_timeout_constant
+                || current.read_timeout_multiplier != timeout.read_timeout_multiplier
+                || current.write_timeout_constant != timeout.write_timeout_constant
+                || current.write_timeout_multiplier != timeout.write_timeout_multiplier
+            ) {
+                value.setTimeout(timeout);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::setFraming(const unsigned int& biteSize, const unsigned int& parity, const unsigned int& stopBits) {
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            serial::bytesize_t internalBiteSize = toBiteSize(biteSize);
+            serial::parity_t internalParity = toParity(parity);
+            serial::stopbits_t internalStopBits = toStopBits(stopBits);
+            serial::Serial& value = getOpenObject();
+            // Every setter of the wrapped library rewrites the termios of the port, so only the changed ones are called.
+            bool changed = false;
+            if (value.getBytesize() != internalBiteSize) {
+                value.setBytesize(internalBiteSize);
+                changed = true;
+            }
+            if (value.getParity() != internalParity) {
+                value.setParity(internalParity);
+                changed = true;
+            }
+            if (value.getStopbits() != internalStopBits) {
+                value.setStopbits(internalStopBits);
+                changed = true;
+            }
+#if defined(__linux__)
+            // The rewrite also reset the speed to the last standard rate the wrapped library knows of.
+            if (changed && customBaudRate != 0) {
+                Termios2::setBaudRate(nativeHandle, customBaudRate);
+            }
+#endif
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::setFlowControl(const unsigned int& flowControl) {
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            serial::flowcontrol_t internalFlowControl = toFlowControl(flowControl);
+            serial::Serial& value = getOpenObject();
+            if (value.getFlowcontrol() != internalFlowControl) {
+                value.setFlowcontrol(internalFlowControl);
+#if defined(__linux__)
+                if (customBaudRate != 0) {
+                    Termios2::setBaudRate(nativeHandle, customBaudRate);
+                }
+#endif
             }
-            return false;
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
         }
@@ -206,36 +435,689 @@ namespace exqudens {
 
     void Serial::close() {
         try {
+            std::error_code error;
+            close(error);
+            if (error) {
+                throw std::system_error(error);
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::close(std::error_code& error) noexcept {
+        error.clear();
+        try {
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            // The writer writes all queued messages while the port is still open.
+            stopWriter();
+            opened.store(false, std::memory_order_release);
+            notifyReaderData();
+#if defined(__linux__)
+            uint64_t value = 1;
+            ssize_t ignored = ::write(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+#endif
+            stopReader();
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            readBufferBegin = 0;
+            readBufferEnd = 0;
+#if defined(__linux__)
+            if (nativeHandle >= 0) {
+                ::close(nativeHandle);
+                nativeHandle = -1;
+            }
+#endif
             if (object) {
                 if (object->isOpen()) {
                     object->close();
                 }
             }
+#if defined(__linux__)
+            ignored = ::read(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+#endif
+        } catch (...) {
+            error = toErrorCode(std::current_exception());
+        }
+    }
+
+    int Serial::getNativeHandle() {
+        return nativeHandle;
+    }
+
+    bool Serial::isIoUringEnabled() {
+#if defined(__linux__)
+        return (bool) ioUring;
+#else
+        return false;
+#endif
+    }
+
+    void Serial::setThreadSafe(const bool& value) {
+        threadSafe = value;
+    }
+
+    bool Serial::isThreadSafe() {
+        return threadSafe;
+    }
+
+#if defined(__linux__)
+    void Serial::setJournal(const std::shared_ptr<Journal>& value) {
+        journal = value;
+    }
+
+    std::shared_ptr<Journal> Serial::getJournal() {
+        return journal;
+    }
+
+    bool Serial::setLowLatency(const LowLatency& value) {
+        try {
+            if (value.busyPoll.count() < 0) {
+                throw std::invalid_argument("busyPoll");
+            }
+            if (value.cpu >= CPU_SETSIZE) {
+                throw std::invalid_argument("cpu");
+            }
+            if (value.priority < 0 || value.priority > sched_get_priority_max(SCHED_FIFO)) {
+                throw std::invalid_argument("priority");
+            }
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            lowLatency = value;
+            if (nativeHandle < 0) {
+                return false;
+            }
+            return Termios2::setLowLatency(nativeHandle, value.enabled);
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
         }
     }
+#endif
 
     size_t Serial::writeBytes(const std::vector<unsigned char>& bytes) {
         try {
+            return writeFrom(std::as_bytes(std::span<const unsigned char>(bytes)));
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<unsigned char> Serial::readBytes(const size_t& size) {
+        try {
+            std::vector<unsigned char> result(size);
+            size_t length = readInto(std::as_writable_bytes(std::span<unsigned char>(result)));
+            result.resize(length);
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Serial::writeFrom(std::span<const std::byte> bytes) {
+        try {
+            std::error_code error;
+            size_t result = writeFrom(bytes, error);
+            if (error) {
+                throw std::system_error(error);
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Serial::writeFrom(std::span<const std::byte> bytes, std::error_code& error) noexcept {
+        error.clear();
+        size_t result = 0;
+        try {
+            std::unique_lock<std::mutex> lock = guard(writeMutex);
             if (!isOpen()) {
-                throw std::runtime_error("device is not open");
+                error = std::make_error_code(std::errc::not_connected);
+                return 0;
+            }
+            if (bytes.empty()) {
+                return 0;
+            }
+#if defined(__linux__)
+            if (ioUring && nativeHandle >= 0) {
+                serial::Timeout timeout = object->getTimeout();
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(
+                    timeout.write_timeout_constant + static_cast<uint64_t>(timeout.write_timeout_multiplier) * bytes.size()
+                );
+                while (result < bytes.size()) {
+                    std::chrono::nanoseconds left = std::max(std::chrono::nanoseconds(0), deadline - std::chrono::steady_clock::now());
+                    size_t length = ioUring->write(nativeHandle, bytes.subspan(result), left);
+                    if (length == 0) {
+                        break;
+                    }
+                    record(true, bytes.subspan(result, length));
+                    result += length;
+                }
+                return result;
+            }
+#endif
+            result = object->write(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+            record(true, bytes.first(result));
+            return result;
+        } catch (...) {
+            error = toErrorCode(std::current_exception());
+            return result;
+        }
+    }
+
+    size_t Serial::writeFrom(std::span<const std::span<const std::byte>> buffers) {
+        try {
+            std::unique_lock<std::mutex> lock = guard(writeMutex);
+            if (!isOpen()) {
+                throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
             }
             size_t result = 0;
-            result = object->write(bytes);
+            for (const std::span<const std::byte>& bytes : buffers) {
+                if (bytes.empty()) {
+                    continue;
+                }
+                size_t length = object->write(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+                record(true, bytes.first(length));
+                result += length;
+                if (length < bytes.size()) {
+                    break;
+                }
+            }
             return result;
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
         }
     }
 
-    std::vector<unsigned char> Serial::readBytes(const size_t& size) {
+    size_t Serial::readInto(std::span<std::byte> bytes) {
+        try {
+            std::error_code error;
+            size_t result = readInto(bytes, error);
+            if (error) {
+                throw std::system_error(error);
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Serial::readInto(std::span<std::byte> bytes, std::error_code& error) noexcept {
+        error.clear();
+        try {
+            std::unique_lock<std::mutex> lock = guard(readMutex);
+            if (readBufferEnd > readBufferBegin) {
+                size_t size = std::min(bytes.size(), readBufferEnd - readBufferBegin);
+                std::memcpy(bytes.data(), readBuffer.data() + readBufferBegin, size);
+                readBufferBegin += size;
+                return size;
+            }
+            return readPort(bytes, error);
+        } catch (...) {
+            error = toErrorCode(std::current_exception());
+            return 0;
+        }
+    }
+
+    std::span<const std::byte> Serial::readUntil(const std::byte& delimiter, const size_t& maxSize) {
         try {
+            if (maxSize == 0) {
+                throw std::invalid_argument("maxSize");
+            }
+            std::unique_lock<std::mutex> lock = guard(readMutex);
+            if (readBufferBegin == readBufferEnd) {
+                readBufferBegin = 0;
+                readBufferEnd = 0;
+            }
+            size_t scanned = readBufferBegin;
+            while (true) {
+                size_t limit = std::min(readBufferEnd, readBufferBegin + maxSize);
+                size_t index = scanned + ByteScanner::find(std::span<const std::byte>(readBuffer.data() + scanned, limit - scanned), delimiter);
+                if (index < limit || limit - readBufferBegin == maxSize) {
+                    size_t size = index < limit ? index + 1 - readBufferBegin : maxSize;
+                    std::span<const std::byte> result(readBuffer.data() + readBufferBegin, size);
+                    readBufferBegin += size;
+                    return result;
+                }
+                scanned = limit;
+                if (readBufferEnd == readBuffer.size()) {
+                    if (readBufferBegin > 0) {
+                        std::memmove(readBuffer.data(), readBuffer.data() + readBufferBegin, readBufferEnd - readBufferBegin);
+                        scanned -= readBufferBegin;
+                        readBufferEnd -= readBufferBegin;
+                        readBufferBegin = 0;
+                    } else {
+                        readBuffer.resize(std::min(std::max<size_t>(readBuffer.size() * 2, 256), maxSize));
+                    }
+                }
+                if (fillReadBuffer(readBuffer.size() - readBufferEnd) == 0) {
+                    return {};
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::string_view Serial::readLine(const size_t& maxSize) {
+        try {
+            std::span<const std::byte> bytes = readUntil(std::byte('\n'), maxSize);
+            return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::exception_ptr Serial::openPort(
+        const std::string& port,
+        const unsigned int& baudRate,
+        const unsigned int& timeoutInterByte,
+        const unsigned int& timeoutReadConstant,
+        const unsigned int& timeoutReadMultiplier,
+        const unsigned int& timeoutWriteConstant,
+        const unsigned int& timeoutWriteMultiplier,
+        const unsigned int& biteSize,
+        const unsigned int& parity,
+        const unsigned int& stopBits,
+        const unsigned int& flowControl
+    ) noexcept {
+        try {
+            LOG_D("port: '" + port + "'");
+
+            std::unique_lock<std::mutex> state = guard(stateMutex);
+            stopReader();
+            stopWriter();
+            std::unique_lock<std::mutex> reading = guard(readMutex);
+            std::unique_lock<std::mutex> writing = guard(writeMutex);
+            opened.store(false, std::memory_order_release);
+            readBufferBegin = 0;
+            readBufferEnd = 0;
+#if defined(__linux__)
+            uint64_t value = 0;
+            ssize_t ignored = ::read(wakeHandle, &value, sizeof(value));
+            (void) ignored;
+#endif
+
+            // Whatever fails after the wrapped port is created must not leave it, or the native handle, open.
+            try {
+                unsigned int internalBaudRate = baudRate;
+#if defined(__linux__)
+                // A rate without a 'Bxxxx' constant would make the wrapped library try a custom divisor,
+                // which ptys and most USB adapters reject, so the port is opened at a standard rate and switched through termios2.
+                customBaudRate = Termios2::isStandardBaudRate(baudRate) ? 0 : baudRate;
+                if (customBaudRate != 0) {
+                    internalBaudRate = 9600;
+                }
+#endif
+
+                object = std::make_unique<serial::Serial>(
+                    port,
+                    internalBaudRate,
+                    serial::Timeout(timeoutInterByte, timeoutReadConstant, timeoutReadMultiplier, timeoutWriteConstant, timeoutWriteMultiplier),
+                    toBiteSize(biteSize),
+                    toParity(parity),
+                    toStopBits(stopBits),
+                    toFlowControl(flowControl)
+                );
+
+#if defined(__linux__)
+                if (nativeHandle >= 0) {
+                    ::close(nativeHandle);
+                }
+                nativeHandle = ::open(port.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+                if (nativeHandle < 0) {
+                    throw std::system_error(errno, std::generic_category(), "open: '" + port + "'");
+                }
+                if (customBaudRate != 0) {
+                    unsigned int applied = Termios2::setBaudRate(nativeHandle, customBaudRate);
+                    if (applied != customBaudRate) {
+                        throw std::system_error(
+                            std::make_error_code(std::errc::invalid_argument),
+                            "baudRate: " + std::to_string(customBaudRate) + " applied: " + std::to_string(applied)
+                        );
+                    }
+                }
+                if (lowLatency.enabled) {
+                    Termios2::setLowLatency(nativeHandle, true);
+                }
+#endif
+                opened.store(object->isOpen(), std::memory_order_release);
+            } catch (...) {
+                releasePort();
+                throw;
+            }
+            return nullptr;
+        } catch (...) {
+            return std::current_exception();
+        }
+    }
+
+    void Serial::releasePort() noexcept {
+        opened.store(false, std::memory_order_release);
+#if defined(__linux__)
+        customBaudRate = 0;
+        if (nativeHandle >= 0) {
+            ::close(nativeHandle);
+            nativeHandle = -1;
+        }
+#endif
+        try {
+            if (object && object->isOpen()) {
+                object->close();
+            }
+        } catch (...) {
+            LOG_E("Error on call function: 'close' of a failed open");
+        }
+    }
+
+    std::error_code Serial::toErrorCode(const std::exception_ptr& exception) noexcept {
+        try {
+            std::rethrow_exception(exception);
+        } catch (const std::system_error& e) {
+            return e.code();
+        } catch (const serial::PortNotOpenedException&) {
+            return std::make_error_code(std::errc::not_connected);
+        } catch (const serial::IOException& e) {
+            if (e.getErrorNumber() != 0) {
+                return std::error_code(e.getErrorNumber(), std::generic_category());
+            }
+            return std::make_error_code(std::errc::io_error);
+        } catch (const std::invalid_argument&) {
+            return std::make_error_code(std::errc::invalid_argument);
+        } catch (const std::bad_alloc&) {
+            return std::make_error_code(std::errc::not_enough_memory);
+        } catch (const std::nested_exception& e) {
+            if (e.nested_ptr()) {
+                return toErrorCode(e.nested_ptr());
+            }
+            return std::make_error_code(std::errc::io_error);
+        } catch (...) {
+            return std::make_error_code(std::errc::io_error);
+        }
+    }
+
+    size_t Serial::readPort(std::span<std::byte> bytes, std::error_code& error) {
+        try {
+            if (readerBuffer) {
+                if (readerFailed.load(std::memory_order_acquire)) {
+                    error = readerError;
+                    return 0;
+                }
+                size_t result = readerBuffer->read(bytes);
+                if (readerThread.joinable() || result > 0) {
+                    return result;
+                }
+                readerBuffer.reset();
+            }
             if (!isOpen()) {
-                throw std::runtime_error("device is not open");
+                error = std::make_error_code(std::errc::not_connected);
+                return 0;
+            }
+            if (bytes.empty()) {
+                return 0;
+            }
+#if defined(__linux__)
+            if ((lowLatency.enabled || threadSafe) && nativeHandle >= 0) {
+                size_t result = readNative(bytes, false, error);
+                if (!error && result == 0 && !isOpen()) {
+                    // Closed during the read.
+                    error = std::make_error_code(std::errc::not_connected);
+                }
+                return result;
             }
-            std::vector<unsigned char> result;
-            object->read(result, size);
+            if (ioUring && nativeHandle >= 0) {
+                serial::Timeout timeout = object->getTimeout();
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(
+                    timeout.read_timeout_constant + static_cast<uint64_t>(timeout.read_timeout_multiplier) * bytes.size()
+                );
+                size_t result = 0;
+                while (result < bytes.size()) {
+                    std::chrono::nanoseconds left = std::max(std::chrono::nanoseconds(0), deadline - std::chrono::steady_clock::now());
+                    size_t length = ioUring->read(nativeHandle, bytes.subspan(result), left);
+                    if (length == 0) {
+                        break;
+                    }
+                    record(false, bytes.subspan(result, length));
+                    result += length;
+                }
+                return result;
+            }
+#endif
+            size_t result = object->read(reinterpret_cast<uint8_t*>(bytes.data()), bytes.size());
+            record(false, bytes.first(result));
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+#if defined(__linux__)
+    size_t Serial::readNative(std::span<std::byte> bytes, const bool& partial, std::error_code& error) noexcept {
+        size_t result = 0;
+        try {
+            serial::Timeout timeout = object->getTimeout();
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            std::chrono::steady_clock::time_point deadline = now + std::chrono::milliseconds(
+                timeout.read_timeout_constant + static_cast<uint64_t>(timeout.read_timeout_multiplier) * bytes.size()
+            );
+            std::chrono::microseconds busyPoll = lowLatency.enabled ? lowLatency.busyPoll : std::chrono::microseconds(0);
+            std::chrono::steady_clock::time_point spinDeadline = now + busyPoll;
+            while (result < bytes.size()) {
+                ssize_t length = ::read(nativeHandle, bytes.data() + result, bytes.size() - result);
+                if (length > 0) {
+                    record(false, bytes.subspan(result, static_cast<size_t>(length)));
+                    result += static_cast<size_t>(length);
+                    if (partial) {
+                        break;
+                    }
+                    spinDeadline = std::chrono::steady_clock::now() + busyPoll;
+                    continue;
+                }
+                if (length == 0) {
+                    break;
+                }
+                if (errno != EAGAIN && errno != EINTR) {
+                    error = std::error_code(errno, std::generic_category());
+                    return result;
+                }
+                now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    break;
+                }
+                if (now < spinDeadline) {
+                    continue;
+                }
+                std::chrono::nanoseconds left = deadline - now;
+                timespec value = {
+                    static_cast<time_t>(left.count() / 1000000000),
+                    static_cast<long>(left.count() % 1000000000)
+                };
+                // The wake handle is signaled by 'close', it stays readable until the close completes.
+                pollfd entries[2] = {{nativeHandle, POLLIN, 0}, {wakeHandle, POLLIN, 0}};
+                int ready = ppoll(entries, 2, &value, nullptr);
+                if (ready < 0 && errno != EINTR) {
+                    error = std::error_code(errno, std::generic_category());
+                    return result;
+                }
+                if (ready == 0 || (entries[1].revents & POLLIN) != 0) {
+                    break;
+                }
+            }
+            return result;
+        } catch (...) {
+            error = toErrorCode(std::current_exception());
+            return result;
+        }
+    }
+
+    void Serial::applyThreadProfile(std::thread& thread) {
+        try {
+            if (lowLatency.cpu >= 0) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(lowLatency.cpu, &set);
+                int error = pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+                if (error != 0) {
+                    throw std::system_error(error, std::generic_category(), "pthread_setaffinity_np");
+                }
+            }
+            if (lowLatency.priority > 0) {
+                sched_param parameter = {};
+                parameter.sched_priority = lowLatency.priority;
+                int error = pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &parameter);
+                if (error != 0) {
+                    throw std::system_error(error, std::generic_category(), "pthread_setschedparam");
+                }
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+#endif
+
+    void Serial::startReader(const size_t& capacity) {
+        try {
+            if (!isOpen()) {
+                throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
+            }
+            if (readerThread.joinable()) {
+                throw std::logic_error("reader is already running");
+            }
+            std::unique_ptr<RingBuffer> buffer = std::make_unique<RingBuffer>(capacity);
+            if (readerBuffer) {
+                std::span<const std::byte> region = readerBuffer->readableRegion();
+                while (!region.empty()) {
+                    buffer->write(region);
+                    readerBuffer->commitRead(region.size());
+                    region = readerBuffer->readableRegion();
+                }
+            }
+            readerBuffer = std::move(buffer);
+            readerStop.store(false, std::memory_order_relaxed);
+            readerFailed.store(false, std::memory_order_relaxed);
+            readerException = nullptr;
+            readerError.clear();
+            readerThread = std::thread(&Serial::readerLoop, this);
+#if defined(__linux__)
+            if (lowLatency.enabled) {
+                try {
+                    applyThreadProfile(readerThread);
+                } catch (...) {
+                    stopReader();
+                    throw;
+                }
+            }
+#endif
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::stopReader() {
+        try {
+            if (readerThread.joinable()) {
+                readerStop.store(true, std::memory_order_relaxed);
+                readerThread.join();
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool Serial::isReaderRunning() {
+        return readerThread.joinable() && !readerFailed.load(std::memory_order_acquire);
+    }
+
+    size_t Serial::getReaderOverflowCount() {
+        return readerBuffer ? readerBuffer->getOverflowCount() : 0;
+    }
+
+    size_t Serial::getReaderHighWaterMark() {
+        return readerBuffer ? readerBuffer->getHighWaterMark() : 0;
+    }
+
+    void Serial::startWriter(const size_t& queueCapacity, const size_t& flushBytes, const unsigned int& flushDelay) {
+        try {
+            if (!isOpen()) {
+                throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
+            }
+            if (writerThread.joinable()) {
+                throw std::logic_error("writer is already running");
+            }
+            if (queueCapacity == 0) {
+                throw std::invalid_argument("queueCapacity");
+            }
+            if (flushBytes == 0) {
+                throw std::invalid_argument("flushBytes");
+            }
+            {
+                // 'writeAsync' checks 'writerStop' under the lock, so it accepts messages only once the writer is configured.
+                std::lock_guard<std::mutex> lock(writerMutex);
+                writerQueueCapacity = queueCapacity;
+                writerFlushBytes = flushBytes;
+                writerFlushDelay = std::chrono::microseconds(flushDelay);
+                writerPendingBytes = 0;
+                writerStop = false;
+                writerBatch.reserve(queueCapacity);
+                writerStaging.resize(flushBytes);
+            }
+            try {
+                writerThread = std::thread(&Serial::writerLoop, this);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(writerMutex);
+                writerStop = true;
+                throw;
+            }
+#if defined(__linux__)
+            if (lowLatency.enabled) {
+                try {
+                    applyThreadProfile(writerThread);
+                } catch (...) {
+                    stopWriter();
+                    throw;
+                }
+            }
+#endif
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void Serial::stopWriter() {
+        try {
+            if (writerThread.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(writerMutex);
+                    writerStop = true;
+                }
+                writerNotEmpty.notify_all();
+                writerNotFull.notify_all();
+                writerThread.join();
+            }
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool Serial::isWriterRunning() {
+        return writerThread.joinable();
+    }
+
+    std::future<size_t> Serial::writeAsync(std::vector<unsigned char> bytes) {
+        try {
+            std::unique_lock<std::mutex> lock(writerMutex);
+            writerNotFull.wait(lock, [this] { return writerStop || writerQueue.size() < writerQueueCapacity; });
+            if (writerStop) {
+                throw std::runtime_error("writer is not running");
+            }
+            writerPendingBytes += bytes.size();
+            WriterEntry& entry = writerQueue.emplace_back(WriterEntry {std::move(bytes), {}, std::chrono::steady_clock::now()});
+            std::future<size_t> result = entry.promise.get_future();
+            lock.unlock();
+            writerNotEmpty.notify_one();
             return result;
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
@@ -243,57 +1125,280 @@ namespace exqudens {
     }
 
     Serial::~Serial() noexcept {
+        try {
+            stopReader();
+        } catch (const std::exception& e) {
+            LOG_E("Error in destructor on call function: 'stopReader': '" + std::string(e.what()) + "'");
+        } catch (...) {
+            LOG_E("Unknown error in destructor on call function: 'stopReader'");
+        }
+        try {
+            stopWriter();
+        } catch (const std::exception& e) {
+            LOG_E("Error in destructor on call function: 'stopWriter': '" + std::string(e.what()) + "'");
+        } catch (...) {
+            LOG_E("Unknown error in destructor on call function: 'stopWriter'");
+        }
         if (autoClose) {
             try {
                 close();
             } catch (const std::exception& e) {
-                log(__FILE__, __LINE__, __FUNCTION__, LOGGER_ID, LOGGER_LEVEL_ERROR, "Error in destructor on call function: 'close': '" + std::string(e.what()) + "'");
+                LOG_E("Error in destructor on call function: 'close': '" + std::string(e.what()) + "'");
             } catch (...) {
-                log(__FILE__, __LINE__, __FUNCTION__, LOGGER_ID, LOGGER_LEVEL_ERROR, "Unknown error in destructor on call function: 'close'");
+                LOG_E("Unknown error in destructor on call function: 'close'");
             }
         }
+#if defined(__linux__)
+        if (nativeHandle >= 0) {
+            ::close(nativeHandle);
+        }
+        if (wakeHandle >= 0) {
+            ::close(wakeHandle);
+        }
+#endif
     }
 
-    std::map<std::string, std::string> Serial::toMap(const serial::PortInfo& value) {
+    size_t Serial::fillReadBuffer(const size_t& size) {
         try {
-            std::map<std::string, std::string> result = {};
-            result.insert({"port", normalize(value.port)});
-            result.insert({"hardware-id", normalize(value.hardware_id)});
-            result.insert({"description", normalize(value.description)});
+            std::span<std::byte> region(readBuffer.data() + readBufferEnd, size);
+            size_t result = 0;
+            std::error_code error;
+            if (readerThread.joinable()) {
+                std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(object->getTimeout().read_timeout_constant);
+                std::unique_lock<std::mutex> lock(readerDataMutex);
+                while ((result = readPort(region, error)) == 0 && !error && isOpen()) {
+                    bool ready = readerData.wait_until(lock, deadline, [this] {
+                        return readerBuffer->size() > 0 || readerFailed.load(std::memory_order_acquire) || !isOpen();
+                    });
+                    if (!ready) {
+                        break;
+                    }
+                }
+            } else {
+                if (!isOpen()) {
+                    throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
+                }
+                result = readPort(region.first(std::clamp<size_t>(object->available(), 1, size)), error);
+            }
+            if (error) {
+                if (readerFailed.load(std::memory_order_acquire)) {
+                    std::rethrow_exception(readerException);
+                }
+                throw std::system_error(error, "read");
+            }
+            readBufferEnd += result;
             return result;
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
         }
     }
 
-    std::string Serial::normalize(const std::string& value) {
+    void Serial::record(const bool& write, std::span<const std::byte> bytes) noexcept {
+#if defined(__linux__)
+        if (journal) {
+            journal->append(write ? Journal::Direction::WRITE : Journal::Direction::READ, bytes);
+        }
+#endif
+    }
+
+    void Serial::readerLoop() {
         try {
-            std::string result = "";
-            for (size_t i = 0; i < value.size(); i++) {
-                if (std::isalnum(value.at(i)) != 0 || std::ispunct(value.at(i)) != 0) {
-                    result += value.at(i);
-                } else if (std::isspace(value.at(i)) != 0) {
-                    result += ' ';
+            bool idleSleep = object->getTimeout().read_timeout_constant == 0;
+            bool native = false;
+#if defined(__linux__)
+            native = (lowLatency.enabled || threadSafe) && nativeHandle >= 0;
+#endif
+            std::byte scratch[256];
+            while (!readerStop.load(std::memory_order_relaxed)) {
+                std::span<std::byte> region = readerBuffer->writableRegion();
+                bool overflow = region.empty();
+                if (overflow) {
+                    region = std::span<std::byte>(scratch);
+                }
+                size_t length = 0;
+                if (native) {
+#if defined(__linux__)
+                    std::error_code error;
+                    length = readNative(region, true, error);
+                    if (error) {
+                        throw std::system_error(error, "read");
+                    }
+#endif
+                } else {
+                    length = object->read(reinterpret_cast<uint8_t*>(region.data()), std::max<size_t>(1, std::min(region.size(), object->available())));
+                    record(false, region.first(length));
+                }
+                if (overflow) {
+                    readerBuffer->addOverflow(length);
+                } else if (length > 0) {
+                    readerBuffer->commitWrite(length);
+                    notifyReaderData();
+                }
+                if (length == 0 && !isOpen()) {
+                    break;
+                }
+                if (length == 0 && idleSleep) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
                 }
             }
-            return result;
         } catch (...) {
-            std::throw_with_nested(std::runtime_error(CALL_INFO));
+            readerException = std::current_exception();
+            readerError = toErrorCode(readerException);
+            readerFailed.store(true, std::memory_order_release);
+        }
+        notifyReaderData();
+    }
+
+    void Serial::notifyReaderData() noexcept {
+        {
+            // Taken so a waiter between its check and its wait does not miss the notification.
+            std::lock_guard<std::mutex> lock(readerDataMutex);
+        }
+        readerData.notify_all();
+    }
+
+    void Serial::writerLoop() {
+        std::unique_lock<std::mutex> lock(writerMutex);
+        while (true) {
+            writerNotEmpty.wait(lock, [this] { return writerStop || !writerQueue.empty(); });
+            if (writerQueue.empty()) {
+                return;
+            }
+            writerNotEmpty.wait_until(lock, writerQueue.front().time + writerFlushDelay, [this] {
+                return writerStop || writerPendingBytes >= writerFlushBytes || writerQueue.size() >= writerQueueCapacity;
+            });
+            size_t batchBytes = 0;
+            while (!writerQueue.empty() && (writerBatch.empty() || batchBytes + writerQueue.front().bytes.size() <= writerFlushBytes)) {
+                batchBytes += writerQueue.front().bytes.size();
+                writerBatch.emplace_back(std::move(writerQueue.front()));
+                writerQueue.pop_front();
+            }
+            writerPendingBytes -= batchBytes;
+            lock.unlock();
+            writerNotFull.notify_all();
+            writerFlush();
+            lock.lock();
+        }
+    }
+
+    void Serial::writerFlush() {
+        try {
+            size_t written = 0;
+            if (writerBatch.size() == 1) {
+                written = writeFrom(std::as_bytes(std::span<const unsigned char>(writerBatch.front().bytes)));
+            } else {
+                size_t length = 0;
+                for (const WriterEntry& entry : writerBatch) {
+                    if (!entry.bytes.empty()) {
+                        std::memcpy(writerStaging.data() + length, entry.bytes.data(), entry.bytes.size());
+                    }
+                    length += entry.bytes.size();
+                }
+                written = writeFrom(std::as_bytes(std::span<const unsigned char>(writerStaging).first(length)));
+            }
+            for (WriterEntry& entry : writerBatch) {
+                size_t length = std::min(written, entry.bytes.size());
+                written -= length;
+                entry.promise.set_value(length);
+            }
+        } catch (...) {
+            std::exception_ptr exception = std::current_exception();
+            for (WriterEntry& entry : writerBatch) {
+                entry.promise.set_exception(exception);
+            }
+        }
+        writerBatch.clear();
+    }
+
+    serial::bytesize_t Serial::toBiteSize(const unsigned int& value) {
+        if (value == 8) {
+            return serial::eightbits;
+        } else if (value == 7) {
+            return serial::sevenbits;
+        } else if (value == 6) {
+            return serial::sixbits;
+        } else if (value == 5) {
+            return serial::fivebits;
+        }
+        throw std::invalid_argument("biteSize");
+    }
+
+    serial::parity_t Serial::toParity(const unsigned int& value) {
+        if (value == 0) {
+            return serial::parity_none;
+        } else if (value == 1) {
+            return serial::parity_odd;
+        } else if (value == 2) {
+            return serial::parity_even;
+        }
+        throw std::invalid_argument("parity");
+    }
+
+    serial::stopbits_t Serial::toStopBits(const unsigned int& value) {
+        if (value == 0) {
+            return serial::stopbits_one;
+        } else if (value == 1) {
+            return serial::stopbits_one_point_five;
+        } else if (value == 2) {
+            return serial::stopbits_two;
+        }
+        throw std::invalid_argument("stopBits");
+    }
+
+    serial::flowcontrol_t Serial::toFlowControl(const unsigned int& value) {
+        if (value == 0) {
+            return serial::flowcontrol_none;
+        } else if (value == 1) {
+            return serial::flowcontrol_software;
+        } else if (value == 2) {
+            return serial::flowcontrol_hardware;
         }
+        throw std::invalid_argument("flowControl");
+    }
+
+    serial::Serial& Serial::getOpenObject() {
+        if (!object || !object->isOpen()) {
+            throw std::system_error(std::make_error_code(std::errc::not_connected), "device is not open");
+        }
+        return *object;
+    }
+
+    unsigned int Serial::getAppliedBaudRate() {
+#if defined(__linux__)
+        getOpenObject();
+        return Termios2::getBaudRate(nativeHandle);
+#else
+        return getOpenObject().getBaudrate();
+#endif
+    }
+
+    std::unique_lock<std::mutex> Serial::guard(std::mutex& value) {
+        if (threadSafe) {
+            return std::unique_lock<std::mutex>(value);
+        }
+        return std::unique_lock<std::mutex>(value, std::defer_lock);
+    }
+
+    bool Serial::isLogEnabled(const unsigned short& level) const noexcept {
+        return level <= logLevel && logFunction;
     }
 
     void Serial::log(
-        const std::string& file,
+        const char* file,
         const size_t& line,
-        const std::string& function,
-        const std::string& id,
+        const char* function,
+        const char* id,
         const unsigned short& level,
         const std::string& message
     ) {
         try {
             if (logFunction) {
-                std::string internalFile = std::filesystem::path(file).filename().string();
-                logFunction(internalFile, line, function, id, level, message);
+                std::string_view internalFile = file;
+                size_t separator = internalFile.find_last_of("/\\");
+                if (separator != std::string_view::npos) {
+                    internalFile.remove_prefix(separator + 1);
+                }
+                logFunction(std::string(internalFile), line, function, id, level, message);
             }
         } catch (...) {
             std::throw_with_nested(std::runtime_error(CALL_INFO));
@@ -306,3 +1411,6 @@ namespace exqudens {
 #undef LOGGER_ID
 #undef LOGGER_LEVEL_ERROR
 #undef LOGGER_LEVEL_DEBUG
+#undef LOG
+#undef LOG_E
+#undef LOG_D
@@ -4,18 +4,48 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <serial/serial.h>
 
 #include "exqudens/serial/ISerial.hpp"
+#include "exqudens/serial/RingBuffer.hpp"
+
+#if defined(__linux__)
+#include "exqudens/serial/IoUring.hpp"
+#include "exqudens/serial/Journal.hpp"
+#endif
 
 namespace exqudens {
 
    class EXQUDENS_SERIAL_EXPORT Serial : public virtual ISerial {
 
+#if defined(__linux__)
+      public:
+
+         struct LowLatency {
+            bool enabled = false;                                                   //!< Enables the profile.
+            std::chrono::microseconds busyPoll = std::chrono::microseconds(50);     //!< A time to spin on non-blocking reads after the last byte before sleeping in 'poll'.
+            int cpu = -1;                                                           //!< A cpu the reader and writer threads are pinned to, -1 leaves them unpinned.
+            int priority = 0;                                                       //!< A 'SCHED_FIFO' priority of the reader and writer threads, 0 keeps the default policy.
+         };
+#endif
+
       private:
 
+         struct WriterEntry {
+            std::vector<unsigned char> bytes;
+            std::promise<size_t> promise;
+            std::chrono::steady_clock::time_point time;
+         };
+
          std::function<void(
             const std::string& file,
             const size_t& line,
@@ -24,11 +54,56 @@ namespace exqudens {
             const unsigned short& level,
             const std::string& message
          )> logFunction;
+         unsigned short logLevel = 6;
          bool autoClose = false;
          std::unique_ptr<serial::Serial> object = nullptr;
+         int nativeHandle = -1;
+         std::atomic<bool> opened = false;
+         bool threadSafe = false;
+         std::mutex stateMutex;
+         std::mutex readMutex;
+         std::mutex writeMutex;
+#if defined(__linux__)
+         int wakeHandle = -1;
+         std::unique_ptr<IoUring> ioUring = nullptr;
+         std::shared_ptr<Journal> journal = nullptr;
+         unsigned int customBaudRate = 0;
+         LowLatency lowLatency;
+#endif
+         std::vector<std::byte> readBuffer;
+         size_t readBufferBegin = 0;
+         size_t readBufferEnd = 0;
+         std::unique_ptr<RingBuffer> readerBuffer = nullptr;
+         std::thread readerThread;
+         std::atomic<bool> readerStop = false;
+         std::atomic<bool> readerFailed = false;
+         std::exception_ptr readerException = nullptr;
+         std::error_code readerError;
+         std::mutex readerDataMutex;
+         std::condition_variable readerData;
+         std::deque<WriterEntry> writerQueue;
+         std::vector<WriterEntry> writerBatch;
+         std::vector<unsigned char> writerStaging;
+         std::mutex writerMutex;
+         std::condition_variable writerNotEmpty;
+         std::condition_variable writerNotFull;
+         size_t writerQueueCapacity = 0;
+         size_t writerFlushBytes = 0;
+         size_t writerPendingBytes = 0;
+         std::chrono::microseconds writerFlushDelay = std::chrono::microseconds(0);
+         bool writerStop = true;
+         std::thread writerThread;
 
       public:
 
+         /*!
+         * Constructor.
+         */
+         Serial(
+            const bool& autoClose,  //!< Close the port in the destructor.
+            const bool& ioUring     //!< Route 'readInto' and 'writeFrom' through a private io_uring on the native handle,
+                                    //!< ignored when the kernel lacks io_uring. Inter-byte timeout is not applied on this path.
+         );
          Serial(const bool& autoClose);
          Serial();
 
@@ -47,10 +122,20 @@ namespace exqudens {
 
          bool isSetLogFunction() override;
 
+         void setLogLevel(const unsigned short& value) override;
+
+         unsigned short getLogLevel() override;
+
          std::string getVersion() override;
 
          std::vector<std::map<std::string, std::string>> listPorts() override;
 
+         PortList findPorts(const PortList::Predicate& predicate = {}) override;
+
+         PortList findPorts(const uint16_t& vendorId, const uint16_t& productId) override;
+
+         PortList findPorts(const std::regex& pattern) override;
+
          void open(
             const std::string& port,
             const unsigned int& baudRate,
@@ -65,31 +150,212 @@ namespace exqudens {
             const unsigned int& flowControl
          ) override;
 
+         void open(
+            const std::string& port,
+            const unsigned int& baudRate,
+            const unsigned int& timeoutInterByte,
+            const unsigned int& timeoutReadConstant,
+            const unsigned int& timeoutReadMultiplier,
+            const unsigned int& timeoutWriteConstant,
+            const unsigned int& timeoutWriteMultiplier,
+            const unsigned int& biteSize,
+            const unsigned int& parity,
+            const unsigned int& stopBits,
+            const unsigned int& flowControl,
+            std::error_code& error
+         ) noexcept override;
+
          void open(const std::string& port, const unsigned int& timeoutSimple) override;
 
+         void open(const std::string& port, const unsigned int& timeoutSimple, std::error_code& error) noexcept override;
+
          void open(const std::string& port) override;
 
          bool isOpen() override;
 
+         unsigned int setBaudRate(const unsigned int& baudRate) override;
+
+         unsigned int getBaudRate() override;
+
+         std::vector<unsigned int> getAchievableBaudRates(const std::vector<unsigned int>& candidates) override;
+
+         void setTimeouts(
+            const unsigned int& timeoutInterByte,
+            const unsigned int& timeoutReadConstant,
+            const unsigned int& timeoutReadMultiplier,
+            const unsigned int& timeoutWriteConstant,
+            const unsigned int& timeoutWriteMultiplier
+         ) override;
+
+         void setFraming(const unsigned int& biteSize, const unsigned int& parity, const unsigned int& stopBits) override;
+
+         void setFlowControl(const unsigned int& flowControl) override;
+
          void close() override;
 
+         void close(std::error_code& error) noexcept override;
+
+         /*!
+         * Gets the non-blocking native handle of the open port, on Linux a second file descriptor
+         * of the same tty opened alongside the wrapped serial library, used by reactors like 'SerialHub'.
+         * Bytes read through it are not seen by 'readInto' and vice versa.
+         *
+         * @return A file descriptor, or -1 if the port is not open or the platform is not supported.
+         */
+         int getNativeHandle();
+
+         /*!
+         * Gets the io_uring backend status.
+         *
+         * @return Returns @b true if reads and writes go through io_uring, @b false otherwise.
+         */
+         bool isIoUringEnabled();
+
+         /*!
+         * Sets the thread-safe mode. In this mode one thread may read while another one writes, each direction has its own lock,
+         * and 'close' may be called from any thread at any time. Open, close and configuration calls are serialized
+         * with each other and wait for the transfers in progress.
+         *
+         * On Linux reads go through the native handle, without the inter-byte timeout, and a concurrent 'close'
+         * wakes a blocked reader which then fails with 'std::errc::not_connected'. Elsewhere 'close' waits for the read to time out.
+         * Must not be called during I/O.
+         */
+         void setThreadSafe(const bool& value);
+
+         /*!
+         * Gets the thread-safe mode status.
+         *
+         * @return Returns @b true if the thread-safe mode is set, @b false otherwise.
+         */
+         bool isThreadSafe();
+
+#if defined(__linux__)
+         /*!
+         * Sets a journal that records every byte received from and sent to the port, @b nullptr stops recording.
+         * Reads are recorded when they leave the port, by the reader thread if it runs. Must not be called during I/O.
+         * 'AsyncSerial', 'SerialHub', 'PortAggregator' and 'Broadcaster' record the bytes they move through the native handle
+         * to this journal too, 'SerialHub' and 'PortAggregator' take it when the port is added.
+         */
+         void setJournal(const std::shared_ptr<Journal>& value);
+
+         /*!
+         * Gets the journal set by 'setJournal', for code doing I/O on the native handle.
+         *
+         * @return A journal, or @b nullptr if none is set.
+         */
+         std::shared_ptr<Journal> getJournal();
+
+         /*!
+         * Sets the low-latency profile. When enabled, reads bypass the wrapped serial library and its byte time waits:
+         * they go through the native handle, spinning for 'busyPoll' before blocking, and the driver is asked for 'ASYNC_LOW_LATENCY'.
+         * The reader and writer threads pick up the cpu and priority when they are started. Must not be called during I/O.
+         *
+         * @return Returns @b true if the driver accepted 'ASYNC_LOW_LATENCY', @b false if it does not support it or the port is not open.
+         *
+         * @throws std::runtime_error.
+         */
+         bool setLowLatency(const LowLatency& value);
+#endif
+
          size_t writeBytes(const std::vector<unsigned char>& bytes) override;
 
          std::vector<unsigned char> readBytes(const size_t& size) override;
 
+         size_t writeFrom(std::span<const std::byte> bytes) override;
+
+         size_t writeFrom(std::span<const std::byte> bytes, std::error_code& error) noexcept override;
+
+         size_t writeFrom(std::span<const std::span<const std::byte>> buffers) override;
+
+         size_t readInto(std::span<std::byte> bytes) override;
+
+         size_t readInto(std::span<std::byte> bytes, std::error_code& error) noexcept override;
+
+         std::span<const std::byte> readUntil(const std::byte& delimiter, const size_t& maxSize) override;
+
+         std::string_view readLine(const size_t& maxSize) override;
+
+         void startReader(const size_t& capacity) override;
+
+         void stopReader() override;
+
+         bool isReaderRunning() override;
+
+         size_t getReaderOverflowCount() override;
+
+         size_t getReaderHighWaterMark() override;
+
+         void startWriter(const size_t& queueCapacity, const size_t& flushBytes, const unsigned int& flushDelay) override;
+
+         void stopWriter() override;
+
+         bool isWriterRunning() override;
+
+         std::future<size_t> writeAsync(std::vector<unsigned char> bytes) override;
+
          ~Serial() noexcept override;
 
       private:
 
-         std::map<std::string, std::string> toMap(const serial::PortInfo& value);
+         static std::error_code toErrorCode(const std::exception_ptr& exception) noexcept;
 
-         std::string normalize(const std::string& value);
+         std::exception_ptr openPort(
+            const std::string& port,
+            const unsigned int& baudRate,
+            const unsigned int& timeoutInterByte,
+            const unsigned int& timeoutReadConstant,
+            const unsigned int& timeoutReadMultiplier,
+            const unsigned int& timeoutWriteConstant,
+            const unsigned int& timeoutWriteMultiplier,
+            const unsigned int& biteSize,
+            const unsigned int& parity,
+            const unsigned int& stopBits,
+            const unsigned int& flowControl
+         ) noexcept;
+
+         void releasePort() noexcept;
+
+         static serial::bytesize_t toBiteSize(const unsigned int& value);
+
+         static serial::parity_t toParity(const unsigned int& value);
+
+         static serial::stopbits_t toStopBits(const unsigned int& value);
+
+         static serial::flowcontrol_t toFlowControl(const unsigned int& value);
+
+         serial::Serial& getOpenObject();
+
+         unsigned int getAppliedBaudRate();
+
+         std::unique_lock<std::mutex> guard(std::mutex& value);
+
+         size_t readPort(std::span<std::byte> bytes, std::error_code& error);
+
+#if defined(__linux__)
+         size_t readNative(std::span<std::byte> bytes, const bool& partial, std::error_code& error) noexcept;
+
+         void applyThreadProfile(std::thread& thread);
+#endif
+
+         size_t fillReadBuffer(const size_t& size);
+
+         void record(const bool& write, std::span<const std::byte> bytes) noexcept;
+
+         void readerLoop();
+
+         void notifyReaderData() noexcept;
+
+         void writerLoop();
+
+         void writerFlush();
+
+         bool isLogEnabled(const unsigned short& level) const noexcept;
 
          void log(
-            const std::string& file,
+            const char* file,
             const size_t& line,
-            const std::string& function,
-            const std::string& id,
+            const char* function,
+            const char* id,
             const unsigned short& level,
             const std::string& message
          );
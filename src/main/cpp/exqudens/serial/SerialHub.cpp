@@ -0,0 +1,332 @@
+/*!
+* @file SerialHub.cpp
+*/
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "exqudens/serial/SerialHub.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+#define MAX_EVENTS 64
+#define MAX_READS_PER_EVENT 4
+
+namespace exqudens {
+
+    SerialHub::SerialHub(const size_t& threadSize, const size_t& bufferSize) {
+        try {
+            if (threadSize == 0) {
+                throw std::invalid_argument("threadSize");
+            }
+            if (bufferSize == 0) {
+                throw std::invalid_argument("bufferSize");
+            }
+            for (size_t i = 0; i < threadSize; i++) {
+                std::unique_ptr<Loop> loop = std::make_unique<Loop>();
+                loop->buffer.resize(bufferSize);
+                loop->epoll = epoll_create1(EPOLL_CLOEXEC);
+                if (loop->epoll < 0) {
+                    throw std::system_error(errno, std::generic_category(), "epoll_create1");
+                }
+                loop->wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                if (loop->wakeup < 0) {
+                    ::close(loop->epoll);
+                    throw std::system_error(errno, std::generic_category(), "eventfd");
+                }
+                epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.ptr = nullptr;
+                if (epoll_ctl(loop->epoll, EPOLL_CTL_ADD, loop->wakeup, &event) != 0) {
+                    ::close(loop->wakeup);
+                    ::close(loop->epoll);
+                    throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+                }
+                loops.emplace_back(std::move(loop));
+            }
+            for (std::unique_ptr<Loop>& loop : loops) {
+                loop->thread = std::thread(&SerialHub::run, this, std::ref(*loop));
+            }
+        } catch (...) {
+            stop();
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t SerialHub::add(const std::shared_ptr<Serial>& serial, Handler handler) {
+        try {
+            if (!serial) {
+                throw std::invalid_argument("serial");
+            }
+            int fd = serial->getNativeHandle();
+            if (fd < 0) {
+                throw std::runtime_error("serial has no native handle");
+            }
+
+            std::unique_ptr<Port> port = std::make_unique<Port>();
+            port->serial = serial;
+            port->fd = fd;
+            port->journal = serial->getJournal();
+            port->handler = std::move(handler);
+
+            Loop* loop = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                port->id = nextId++;
+                loop = loops.at(nextLoop++ % loops.size()).get();
+                portLoops[port->id] = loop;
+            }
+
+            size_t id = port->id;
+            try {
+                execute(*loop, [loop, &port] {
+                    epoll_event event = {};
+                    event.events = EPOLLIN | EPOLLRDHUP;
+                    event.data.ptr = port.get();
+                    if (epoll_ctl(loop->epoll, EPOLL_CTL_ADD, port->fd, &event) != 0) {
+                        throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+                    }
+                    loop->ports[port->id] = std::move(port);
+                });
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                portLoops.erase(id);
+                throw;
+            }
+            return id;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void SerialHub::remove(const size_t& id) {
+        try {
+            Loop* loop = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto entry = portLoops.find(id);
+                if (entry == portLoops.end()) {
+                    return;
+                }
+                loop = entry->second;
+                portLoops.erase(entry);
+            }
+            execute(*loop, [this, loop, id] {
+                detach(*loop, id);
+            });
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    void SerialHub::setWriteInterest(const size_t& id, const bool& value) {
+        try {
+            Loop* loop = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                loop = portLoops.at(id);
+            }
+            execute(*loop, [loop, id, value] {
+                auto entry = loop->ports.find(id);
+                if (entry == loop->ports.end() || entry->second->writeInterest == value) {
+                    return;
+                }
+                epoll_event event = {};
+                event.events = EPOLLIN | EPOLLRDHUP | (value ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+                event.data.ptr = entry->second.get();
+                if (epoll_ctl(loop->epoll, EPOLL_CTL_MOD, entry->second->fd, &event) != 0) {
+                    throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+                }
+                entry->second->writeInterest = value;
+            });
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t SerialHub::getPortCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return portLoops.size();
+    }
+
+    size_t SerialHub::getThreadCount() const {
+        return loops.size();
+    }
+
+    void SerialHub::stop() {
+        for (std::unique_ptr<Loop>& loop : loops) {
+            std::lock_guard<std::mutex> lock(loop->mutex);
+            stopped.store(true);
+        }
+        for (std::unique_ptr<Loop>& loop : loops) {
+            if (loop->thread.joinable()) {
+                uint64_t value = 1;
+                ssize_t ignored = ::write(loop->wakeup, &value, sizeof(value));
+                (void) ignored;
+                loop->thread.join();
+            }
+        }
+        for (std::unique_ptr<Loop>& loop : loops) {
+            std::vector<std::function<void()>> tasks;
+            {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                tasks.swap(loop->tasks);
+            }
+            for (std::function<void()>& task : tasks) {
+                task();
+            }
+            loop->ports.clear();
+            loop->removedPorts.clear();
+            if (loop->wakeup >= 0) {
+                ::close(loop->wakeup);
+                loop->wakeup = -1;
+            }
+            if (loop->epoll >= 0) {
+                ::close(loop->epoll);
+                loop->epoll = -1;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        portLoops.clear();
+    }
+
+    SerialHub::~SerialHub() noexcept {
+        stop();
+    }
+
+    void SerialHub::run(Loop& loop) {
+        epoll_event events[MAX_EVENTS];
+        while (!stopped.load()) {
+            int size = epoll_wait(loop.epoll, events, MAX_EVENTS, -1);
+            if (size < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            for (int i = 0; i < size; i++) {
+                if (events[i].data.ptr == nullptr) {
+                    uint64_t value = 0;
+                    ssize_t ignored = ::read(loop.wakeup, &value, sizeof(value));
+                    (void) ignored;
+                    std::vector<std::function<void()>> tasks;
+                    {
+                        std::lock_guard<std::mutex> lock(loop.mutex);
+                        tasks.swap(loop.tasks);
+                    }
+                    for (std::function<void()>& task : tasks) {
+                        task();
+                    }
+                    continue;
+                }
+                Port* port = static_cast<Port*>(events[i].data.ptr);
+                if (!port->removed) {
+                    dispatch(loop, *port, events[i].events);
+                }
+            }
+            loop.removedPorts.clear();
+        }
+    }
+
+    void SerialHub::execute(Loop& loop, std::function<void()> task) {
+        if (loop.thread.get_id() == std::this_thread::get_id()) {
+            task();
+            return;
+        }
+        std::shared_ptr<std::promise<void>> promise = std::make_shared<std::promise<void>>();
+        std::future<void> future = promise->get_future();
+        {
+            std::lock_guard<std::mutex> lock(loop.mutex);
+            if (stopped.load()) {
+                throw std::runtime_error("hub is stopped");
+            }
+            loop.tasks.emplace_back([promise, task = std::move(task)] {
+                try {
+                    task();
+                    promise->set_value();
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+        }
+        uint64_t value = 1;
+        if (::write(loop.wakeup, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+            throw std::system_error(errno, std::generic_category(), "eventfd write");
+        }
+        future.get();
+    }
+
+    void SerialHub::dispatch(Loop& loop, Port& port, const unsigned int& events) {
+        try {
+            if ((events & (EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0) {
+                for (size_t i = 0; i < MAX_READS_PER_EVENT; i++) {
+                    ssize_t length = ::read(port.fd, loop.buffer.data(), loop.buffer.size());
+                    if (length > 0) {
+                        if (port.journal) {
+                            port.journal->append(Journal::Direction::READ, std::span<const std::byte>(loop.buffer.data(), static_cast<size_t>(length)));
+                        }
+                        if (port.handler.onRead) {
+                            port.handler.onRead(std::span<const std::byte>(loop.buffer.data(), static_cast<size_t>(length)));
+                        }
+                        if (port.removed || static_cast<size_t>(length) < loop.buffer.size()) {
+                            break;
+                        }
+                    } else if (length < 0 && (errno == EAGAIN || errno == EINTR)) {
+                        break;
+                    } else if (length == 0) {
+                        throw std::runtime_error("end of file");
+                    } else {
+                        throw std::system_error(errno, std::generic_category(), "read");
+                    }
+                }
+            }
+            if ((events & EPOLLOUT) != 0 && !port.removed && port.writeInterest && port.handler.onWritable) {
+                port.handler.onWritable();
+            }
+        } catch (...) {
+            fail(loop, port, std::current_exception());
+        }
+    }
+
+    void SerialHub::fail(Loop& loop, Port& port, const std::exception_ptr& exception) {
+        if (port.removed) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            portLoops.erase(port.id);
+        }
+        detach(loop, port.id);
+        if (port.handler.onError) {
+            try {
+                port.handler.onError(exception);
+            } catch (...) {
+                // Dropped, the port is already removed and the loop thread has no caller to report to.
+            }
+        }
+    }
+
+    void SerialHub::detach(Loop& loop, const size_t& id) {
+        auto entry = loop.ports.find(id);
+        if (entry == loop.ports.end()) {
+            return;
+        }
+        epoll_ctl(loop.epoll, EPOLL_CTL_DEL, entry->second->fd, nullptr);
+        entry->second->removed = true;
+        loop.removedPorts.emplace_back(std::move(entry->second));
+        loop.ports.erase(entry);
+    }
+
+}
+
+#undef CALL_INFO
+#undef MAX_EVENTS
+#undef MAX_READS_PER_EVENT
@@ -0,0 +1,164 @@
+/*!
+* @file SerialHub.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Epoll based reactor that serves many open ports from a small fixed number of threads (Linux only).
+    *
+    * Every registered port is bound to one thread, so handlers of the same port are never called concurrently.
+    * The hub reads from the native handle of the port itself and passes the received bytes to the handler,
+    * they are recorded to the journal the port had when it was added. Handlers writing to the native handle record their own bytes.
+    */
+    class EXQUDENS_SERIAL_EXPORT SerialHub {
+
+        public:
+
+            struct Handler {
+                std::function<void(std::span<const std::byte> bytes)> onRead;       //!< Called with bytes read from the port, the view is valid during the call only.
+                std::function<void()> onWritable;                                    //!< Called when the port is writable and write interest is set.
+                std::function<void(const std::exception_ptr& exception)> onError;   //!< Called once on read error, hang up or handler exception, the port is removed afterwards. Exceptions it throws are dropped.
+            };
+
+        private:
+
+            struct Port {
+                size_t id = 0;
+                std::shared_ptr<Serial> serial = nullptr;
+                int fd = -1;
+                std::shared_ptr<Journal> journal = nullptr;
+                Handler handler;
+                bool writeInterest = false;
+                bool removed = false;
+            };
+
+            struct Loop {
+                int epoll = -1;
+                int wakeup = -1;
+                std::thread thread;
+                std::mutex mutex;
+                std::vector<std::function<void()>> tasks;
+                std::map<size_t, std::unique_ptr<Port>> ports;
+                std::vector<std::unique_ptr<Port>> removedPorts;
+                std::vector<std::byte> buffer;
+            };
+
+            std::vector<std::unique_ptr<Loop>> loops;
+            std::mutex mutex;
+            std::map<size_t, Loop*> portLoops;
+            size_t nextId = 1;
+            size_t nextLoop = 0;
+            std::atomic<bool> stopped = false;
+
+        public:
+
+            /*!
+            * Constructor, starts the threads.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            explicit SerialHub(
+                const size_t& threadSize = 1,       //!< A number of threads serving all ports.
+                const size_t& bufferSize = 65536    //!< A per-thread read buffer size, upper bound of one 'onRead' call.
+            );
+
+            SerialHub(const SerialHub&) = delete;
+
+            SerialHub& operator=(const SerialHub&) = delete;
+
+            /*!
+            * Registers an open port.
+            *
+            * @return A port id used by 'remove' and 'setWriteInterest'.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t add(
+                const std::shared_ptr<Serial>& serial,  //!< An open port.
+                Handler handler                         //!< A port handler.
+            );
+
+            /*!
+            * Unregisters a port, after return no handler of the port is running or will be called.
+            * May be called from a handler.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void remove(
+                const size_t& id //!< A port id.
+            );
+
+            /*!
+            * Enables or disables 'onWritable' notifications of a port.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void setWriteInterest(
+                const size_t& id,   //!< A port id.
+                const bool& value   //!< @b true to receive 'onWritable' calls.
+            );
+
+            /*!
+            * Gets number of registered ports.
+            *
+            * @return A port count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getPortCount();
+
+            /*!
+            * Gets number of threads.
+            *
+            * @return A thread count.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getThreadCount() const;
+
+            /*!
+            * Stops the threads and unregisters all ports without calling handlers.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void stop();
+
+            /*!
+            * Destructor, calls 'stop'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~SerialHub() noexcept;
+
+        private:
+
+            void run(Loop& loop);
+
+            void execute(Loop& loop, std::function<void()> task);
+
+            void dispatch(Loop& loop, Port& port, const unsigned int& events);
+
+            void fail(Loop& loop, Port& port, const std::exception_ptr& exception);
+
+            void detach(Loop& loop, const size_t& id);
+
+    };
+
+}
@@ -0,0 +1,101 @@
+/*!
+* @file Slip.cpp
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "exqudens/serial/Slip.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    size_t Slip::getMaxEncodedSize(const size_t& size) {
+        return size * 2 + 2;
+    }
+
+    size_t Slip::getEncodedSize(std::span<const std::byte> bytes) {
+        size_t result = bytes.size() + 2;
+        for (size_t i = ByteScanner::findAny(bytes, END, ESC); i < bytes.size(); i += ByteScanner::findAny(bytes.subspan(i + 1), END, ESC) + 1) {
+            result++;
+        }
+        return result;
+    }
+
+    size_t Slip::encode(std::span<std::byte> buffer, const size_t& size) {
+        try {
+            if (buffer.size() < size) {
+                throw std::length_error("buffer size: " + std::to_string(buffer.size()) + " less than: " + std::to_string(size));
+            }
+            size_t required = getEncodedSize(buffer.first(size));
+            if (buffer.size() < required) {
+                throw std::length_error("buffer size: " + std::to_string(buffer.size()) + " less than: " + std::to_string(required));
+            }
+
+            // The payload is moved to the end of the encoded range, every escape shortens the lead of input over output by one byte.
+            size_t offset = required - size - 1;
+            std::memmove(buffer.data() + offset, buffer.data(), size);
+            const std::byte* input = buffer.data() + offset;
+            const std::byte* end = input + size;
+            std::byte* output = buffer.data();
+
+            *output++ = END;
+            while (input < end) {
+                size_t run = ByteScanner::findAny(std::span<const std::byte>(input, end), END, ESC);
+                std::memmove(output, input, run);
+                output += run;
+                input += run;
+                if (input < end) {
+                    std::byte value = *input++;
+                    *output++ = ESC;
+                    *output++ = value == END ? ESC_END : ESC_ESC;
+                }
+            }
+            *output++ = END;
+
+            return static_cast<size_t>(output - buffer.data());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t Slip::decode(std::span<std::byte> buffer) {
+        try {
+            const std::byte* input = buffer.data();
+            const std::byte* end = input + buffer.size();
+            std::byte* output = buffer.data();
+
+            while (input < end) {
+                size_t run = ByteScanner::find(std::span<const std::byte>(input, end), ESC);
+                std::memmove(output, input, run);
+                output += run;
+                input += run;
+                if (input < end) {
+                    if (input + 1 == end) {
+                        throw std::invalid_argument("escape at end of frame");
+                    }
+                    std::byte value = input[1];
+                    if (value == ESC_END) {
+                        *output++ = END;
+                    } else if (value == ESC_ESC) {
+                        *output++ = ESC;
+                    } else {
+                        throw std::invalid_argument("invalid escape: " + std::to_string(static_cast<unsigned int>(value)));
+                    }
+                    input += 2;
+                }
+            }
+
+            return static_cast<size_t>(output - buffer.data());
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+}
+
+#undef CALL_INFO
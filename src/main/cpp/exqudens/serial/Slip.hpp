@@ -0,0 +1,73 @@
+/*!
+* @file Slip.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Serial line internet protocol framing (RFC 1055), frames are delimited by 'END' bytes.
+    */
+    class EXQUDENS_SERIAL_EXPORT Slip {
+
+        public:
+
+            static constexpr std::byte END = std::byte(0xC0);
+            static constexpr std::byte ESC = std::byte(0xDB);
+            static constexpr std::byte ESC_END = std::byte(0xDC);
+            static constexpr std::byte ESC_ESC = std::byte(0xDD);
+
+            /*!
+            * Gets maximal encoded size of a payload, including the leading and trailing 'END'.
+            *
+            * @return A size in bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t getMaxEncodedSize(
+                const size_t& size //!< A payload size in bytes.
+            );
+
+            /*!
+            * Gets exact encoded size of a payload, including the leading and trailing 'END'.
+            *
+            * @return A size in bytes.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t getEncodedSize(
+                std::span<const std::byte> bytes //!< A payload.
+            );
+
+            /*!
+            * Encodes a payload in place, the result starts and ends with 'END'.
+            *
+            * @return An encoded size in bytes.
+            *
+            * @throws std::runtime_error with std::length_error nested if the buffer is smaller than the encoded size.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t encode(
+                std::span<std::byte> buffer,    //!< A buffer holding the payload in its first 'size' bytes.
+                const size_t& size              //!< A payload size in bytes.
+            );
+
+            /*!
+            * Decodes a frame in place.
+            *
+            * @return A payload size in bytes, the payload occupies the beginning of the buffer.
+            *
+            * @throws std::runtime_error with std::invalid_argument nested if the frame has an invalid escape sequence.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static size_t decode(
+                std::span<std::byte> buffer //!< A buffer holding one encoded frame without 'END' bytes.
+            );
+
+    };
+
+}
@@ -0,0 +1,167 @@
+/*!
+* @file Task.hpp
+*/
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace exqudens {
+
+    template<typename T>
+    class Task;
+
+    /*!
+    * Promise state shared by all task result types.
+    */
+    class TaskPromiseBase {
+
+        public:
+
+            struct FinalAwaiter {
+
+                bool await_ready() noexcept {
+                    return false;
+                }
+
+                template<typename P>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+                    std::coroutine_handle<> continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}
+
+            };
+
+            std::coroutine_handle<> continuation = nullptr;
+            std::exception_ptr exception = nullptr;
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                exception = std::current_exception();
+            }
+
+    };
+
+    template<typename T>
+    class TaskPromise : public TaskPromiseBase {
+
+        public:
+
+            std::optional<T> value = {};
+
+            Task<T> get_return_object() noexcept;
+
+            template<typename V>
+            void return_value(V&& result) {
+                value.emplace(std::forward<V>(result));
+            }
+
+            T result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+                return std::move(value.value());
+            }
+
+    };
+
+    template<>
+    class TaskPromise<void> : public TaskPromiseBase {
+
+        public:
+
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+    };
+
+    /*!
+    * Lazily started coroutine result, the body runs when the task is awaited.
+    */
+    template<typename T>
+    class Task {
+
+        public:
+
+            using promise_type = TaskPromise<T>;
+
+        private:
+
+            std::coroutine_handle<promise_type> handle = nullptr;
+
+        public:
+
+            Task() = default;
+
+            explicit Task(std::coroutine_handle<promise_type> handle): handle(handle) {}
+
+            Task(const Task&) = delete;
+
+            Task& operator=(const Task&) = delete;
+
+            Task(Task&& other) noexcept: handle(std::exchange(other.handle, nullptr)) {}
+
+            Task& operator=(Task&& other) noexcept {
+                if (this != &other) {
+                    if (handle) {
+                        handle.destroy();
+                    }
+                    handle = std::exchange(other.handle, nullptr);
+                }
+                return *this;
+            }
+
+            bool isDone() const {
+                return !handle || handle.done();
+            }
+
+            bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() {
+                return handle.promise().result();
+            }
+
+            ~Task() {
+                if (handle) {
+                    handle.destroy();
+                }
+            }
+
+    };
+
+    template<typename T>
+    inline Task<T> TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+
+}
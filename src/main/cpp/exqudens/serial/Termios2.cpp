@@ -0,0 +1,115 @@
+/*!
+* @file Termios2.cpp
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+// Kept apart from the rest of the library, 'asm/termbits.h' conflicts with 'termios.h'.
+#include <asm/termbits.h>
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+
+#include "exqudens/serial/Termios2.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    namespace {
+
+        const unsigned int STANDARD_BAUD_RATES[] = {
+            50, 75, 110, 134, 150, 200, 300, 600, 1200, 1800, 2400, 4800, 9600, 19200, 38400, 57600,
+            115200, 230400, 460800, 500000, 576000, 921600, 1000000, 1152000, 1500000, 2000000, 2500000, 3000000, 3500000, 4000000
+        };
+
+        termios2 getAttributes(const int& handle) {
+            termios2 result = {};
+            if (ioctl(handle, TCGETS2, &result) != 0) {
+                throw std::system_error(errno, std::generic_category(), "ioctl TCGETS2");
+            }
+            return result;
+        }
+
+        void setAttributes(const int& handle, const termios2& value) {
+            if (ioctl(handle, TCSETS2, &value) != 0) {
+                throw std::system_error(errno, std::generic_category(), "ioctl TCSETS2");
+            }
+        }
+
+        void setSpeed(termios2& value, const unsigned int& baudRate) {
+            value.c_cflag &= ~(CBAUD | (CBAUD << IBSHIFT));
+            value.c_cflag |= BOTHER | (BOTHER << IBSHIFT);
+            value.c_ispeed = baudRate;
+            value.c_ospeed = baudRate;
+        }
+
+    }
+
+    bool Termios2::isStandardBaudRate(const unsigned int& baudRate) {
+        return std::ranges::find(STANDARD_BAUD_RATES, baudRate) != std::end(STANDARD_BAUD_RATES);
+    }
+
+    unsigned int Termios2::setBaudRate(const int& handle, const unsigned int& baudRate) {
+        try {
+            if (baudRate == 0) {
+                throw std::invalid_argument("baudRate");
+            }
+            termios2 value = getAttributes(handle);
+            setSpeed(value, baudRate);
+            setAttributes(handle, value);
+            return getAttributes(handle).c_ospeed;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    unsigned int Termios2::getBaudRate(const int& handle) {
+        try {
+            return getAttributes(handle).c_ospeed;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::vector<unsigned int> Termios2::getAchievableBaudRates(const int& handle, const std::vector<unsigned int>& candidates) {
+        try {
+            termios2 original = getAttributes(handle);
+            std::vector<unsigned int> results;
+            results.reserve(candidates.size());
+            for (unsigned int candidate : candidates) {
+                termios2 value = original;
+                setSpeed(value, candidate);
+                if (candidate == 0 || ioctl(handle, TCSETS2, &value) != 0) {
+                    results.emplace_back(0);
+                    continue;
+                }
+                results.emplace_back(getAttributes(handle).c_ospeed);
+            }
+            setAttributes(handle, original);
+            return results;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    bool Termios2::setLowLatency(const int& handle, const bool& value) noexcept {
+        serial_struct info = {};
+        if (ioctl(handle, TIOCGSERIAL, &info) != 0) {
+            return false;
+        }
+        if (value) {
+            info.flags |= ASYNC_LOW_LATENCY;
+        } else {
+            info.flags &= ~ASYNC_LOW_LATENCY;
+        }
+        return ioctl(handle, TIOCSSERIAL, &info) == 0;
+    }
+
+}
+
+#undef CALL_INFO
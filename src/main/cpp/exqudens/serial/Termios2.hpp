@@ -0,0 +1,84 @@
+/*!
+* @file Termios2.hpp
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Arbitrary baud rates through 'termios2' and 'BOTHER', and other tty driver settings the wrapped serial library does not cover (Linux only).
+    *
+    * The driver rounds a requested rate to what its clock divider can produce and reports the result back,
+    * so every baud rate function returns the rate read back after applying it rather than the requested one.
+    */
+    class EXQUDENS_SERIAL_EXPORT Termios2 {
+
+        public:
+
+            /*!
+            * Checks if a baud rate has a 'Bxxxx' constant, those are applied by the wrapped serial library.
+            *
+            * @return @b true if the rate is standard.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static bool isStandardBaudRate(
+                const unsigned int& baudRate //!< A baud rate.
+            );
+
+            /*!
+            * Sets input and output baud rate, other termios fields are kept.
+            *
+            * @return A baud rate applied by the driver.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static unsigned int setBaudRate(
+                const int& handle,              //!< A tty file descriptor.
+                const unsigned int& baudRate    //!< A baud rate.
+            );
+
+            /*!
+            * Gets output baud rate.
+            *
+            * @return A baud rate.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static unsigned int getBaudRate(
+                const int& handle //!< A tty file descriptor.
+            );
+
+            /*!
+            * Applies every candidate in turn and reads back what the driver made of it, then restores the original settings.
+            *
+            * @return A baud rates applied for the candidates in the same order, @b 0 for a candidate the driver rejected.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static std::vector<unsigned int> getAchievableBaudRates(
+                const int& handle,                              //!< A tty file descriptor.
+                const std::vector<unsigned int>& candidates     //!< A requested baud rates.
+            );
+
+            /*!
+            * Sets or clears 'ASYNC_LOW_LATENCY', which makes drivers like 'ftdi_sio' hand over received bytes without batching them.
+            *
+            * @return @b true if the driver accepted the flag, @b false if it does not support it.
+            */
+            EXQUDENS_SERIAL_INLINE
+            static bool setLowLatency(
+                const int& handle,  //!< A tty file descriptor.
+                const bool& value   //!< A flag value.
+            ) noexcept;
+
+    };
+
+}
@@ -0,0 +1,206 @@
+/*!
+* @file TransactionEngine.cpp
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "exqudens/serial/TransactionEngine.hpp"
+
+#define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
+
+namespace exqudens {
+
+    TransactionEngine::TransactionEngine(
+        std::shared_ptr<ISerial> serial,
+        const KeyExtractor& responseKey,
+        const FrameLength& frameLength,
+        const size_t& depth,
+        const size_t& maxResponseSize,
+        const KeyExtractor& requestKey
+    ):
+        serial(std::move(serial)),
+        responseKey(responseKey),
+        requestKey(requestKey ? requestKey : responseKey),
+        frameLength(frameLength),
+        maxResponseSize(maxResponseSize),
+        slots(static_cast<std::ptrdiff_t>(depth))
+    {
+        try {
+            if (!this->serial) {
+                throw std::invalid_argument("serial");
+            }
+            if (!this->responseKey) {
+                throw std::invalid_argument("responseKey");
+            }
+            if (!this->frameLength) {
+                throw std::invalid_argument("frameLength");
+            }
+            if (depth == 0 || depth > static_cast<size_t>(std::counting_semaphore<>::max())) {
+                throw std::invalid_argument("depth");
+            }
+            if (maxResponseSize == 0) {
+                throw std::invalid_argument("maxResponseSize");
+            }
+            readerThread = std::thread(&TransactionEngine::readerLoop, this);
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    std::future<std::vector<std::byte>> TransactionEngine::submit(std::span<const std::byte> request, const std::chrono::milliseconds& timeout) {
+        try {
+            if (request.empty()) {
+                throw std::invalid_argument("request");
+            }
+            Key key = requestKey(request);
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+            std::promise<std::vector<std::byte>> promise;
+            std::future<std::vector<std::byte>> result = promise.get_future();
+
+            if (!slots.try_acquire_until(deadline)) {
+                promise.set_exception(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::timed_out), "no free slot before the deadline")));
+                return result;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (readerException || stopped.load(std::memory_order_acquire)) {
+                    slots.release();
+                    promise.set_exception(readerException ? readerException : std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::operation_canceled), "engine is stopped")));
+                    return result;
+                }
+                if (pending.contains(key)) {
+                    slots.release();
+                    throw std::invalid_argument("request key " + std::to_string(key) + " is already in flight");
+                }
+                pending.emplace(key, Pending {std::move(promise), deadline});
+            }
+
+            try {
+                std::lock_guard<std::mutex> lock(writeMutex);
+                size_t written = serial->writeFrom(request);
+                if (written != request.size()) {
+                    throw std::system_error(std::make_error_code(std::errc::timed_out), "written " + std::to_string(written) + " of " + std::to_string(request.size()) + " bytes");
+                }
+            } catch (...) {
+                fail(key, std::current_exception());
+            }
+            return result;
+        } catch (...) {
+            std::throw_with_nested(std::runtime_error(CALL_INFO));
+        }
+    }
+
+    size_t TransactionEngine::getInFlightCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pending.size();
+    }
+
+    size_t TransactionEngine::getUnmatchedCount() const {
+        return unmatchedCount.load(std::memory_order_relaxed);
+    }
+
+    void TransactionEngine::stop() noexcept {
+        if (stopped.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (readerThread.joinable()) {
+            readerThread.join();
+        }
+        failAll(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::operation_canceled), "engine is stopped")));
+    }
+
+    TransactionEngine::~TransactionEngine() noexcept {
+        stop();
+    }
+
+    void TransactionEngine::readerLoop() {
+        try {
+            std::vector<std::byte> buffer(maxResponseSize);
+            size_t size = 0;
+            while (!stopped.load(std::memory_order_acquire)) {
+                size_t need = frameLength(std::span<const std::byte>(buffer.data(), size));
+                if (need == 0 || need > buffer.size()) {
+                    throw std::length_error("frame length " + std::to_string(need) + " is out of range 1.." + std::to_string(buffer.size()));
+                }
+                if (size < need) {
+                    size += serial->readInto(std::span<std::byte>(buffer.data() + size, need - size));
+                } else {
+                    std::span<const std::byte> response(buffer.data(), need);
+                    complete(responseKey(response), response);
+                    std::memmove(buffer.data(), buffer.data() + need, size - need);
+                    size -= need;
+                }
+                expire();
+            }
+        } catch (...) {
+            std::exception_ptr exception;
+            try {
+                std::throw_with_nested(std::runtime_error(CALL_INFO));
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                readerException = exception;
+            }
+            failAll(exception);
+        }
+    }
+
+    void TransactionEngine::expire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.empty()) {
+            return;
+        }
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (auto i = pending.begin(); i != pending.end();) {
+            if (i->second.deadline <= now) {
+                i->second.promise.set_exception(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::timed_out), "no response before the deadline")));
+                i = pending.erase(i);
+                slots.release();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void TransactionEngine::complete(const Key& key, std::span<const std::byte> response) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto i = pending.find(key);
+        if (i == pending.end()) {
+            unmatchedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        i->second.promise.set_value(std::vector<std::byte>(response.begin(), response.end()));
+        pending.erase(i);
+        slots.release();
+    }
+
+    void TransactionEngine::fail(const Key& key, const std::exception_ptr& exception) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto i = pending.find(key);
+        if (i == pending.end()) {
+            return;
+        }
+        i->second.promise.set_exception(exception);
+        pending.erase(i);
+        slots.release();
+    }
+
+    void TransactionEngine::failAll(const std::exception_ptr& exception) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& [key, value] : pending) {
+            value.promise.set_exception(exception);
+            slots.release();
+        }
+        pending.clear();
+    }
+
+}
+
+#undef CALL_INFO
@@ -0,0 +1,157 @@
+/*!
+* @file TransactionEngine.hpp
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "exqudens/serial/export.hpp"
+#include "exqudens/serial/ISerial.hpp"
+
+namespace exqudens {
+
+    /*!
+    * Keeps up to 'depth' requests in flight on one port and matches the responses to them by a key,
+    * for devices that accept several outstanding commands tagged with sequence ids.
+    *
+    * Requests are written by the submitting thread, responses are read by a dedicated thread that cuts them
+    * with the frame length function, takes their key and completes the future of the request with the same key.
+    * Responses may arrive in any order, a response whose request is unknown or already expired is counted and dropped.
+    *
+    * Deadlines are checked between reads, so an expired request fails up to one port read timeout late.
+    * The port must stay open and must not be read by anyone else while the engine runs.
+    * Reads and writes happen on different threads, a 'Serial' port should be in its thread-safe mode.
+    */
+    class EXQUDENS_SERIAL_EXPORT TransactionEngine {
+
+        public:
+
+            using Key = uint64_t;
+
+            using KeyExtractor = std::function<Key(
+                std::span<const std::byte> frame //!< A complete request or response.
+            )>;
+
+            using FrameLength = std::function<size_t(
+                std::span<const std::byte> head //!< A bytes received so far of the next response, possibly empty.
+            )>;
+
+        private:
+
+            struct Pending {
+                std::promise<std::vector<std::byte>> promise;
+                std::chrono::steady_clock::time_point deadline;
+            };
+
+            std::shared_ptr<ISerial> serial;
+            KeyExtractor responseKey;
+            KeyExtractor requestKey;
+            FrameLength frameLength;
+            size_t maxResponseSize = 0;
+            std::counting_semaphore<> slots;
+            std::mutex mutex;
+            std::unordered_map<Key, Pending> pending;
+            std::mutex writeMutex;
+            std::atomic<bool> stopped = false;
+            std::exception_ptr readerException = nullptr;
+            std::atomic<size_t> unmatchedCount = 0;
+            std::thread readerThread;
+
+        public:
+
+            /*!
+            * Constructor, starts the reader thread.
+            *
+            * The frame length function gets the bytes received so far of the next response and returns its total size,
+            * or the number of bytes it needs to tell that size when it is larger than the given bytes,
+            * for example the header size until the header is complete. The reader never asks the port for more bytes than that.
+            *
+            * @throws std::runtime_error.
+            */
+            EXQUDENS_SERIAL_INLINE
+            TransactionEngine(
+                std::shared_ptr<ISerial> serial,        //!< An open serial port.
+                const KeyExtractor& responseKey,        //!< A key of a complete response.
+                const FrameLength& frameLength,         //!< A size of the next response.
+                const size_t& depth = 8,                //!< A maximal number of requests in flight.
+                const size_t& maxResponseSize = 4096,   //!< A maximal response size, a larger response stops the engine.
+                const KeyExtractor& requestKey = {}     //!< A key of a request, the response key extractor if empty.
+            );
+
+            TransactionEngine(const TransactionEngine&) = delete;
+
+            TransactionEngine& operator=(const TransactionEngine&) = delete;
+
+            /*!
+            * Writes the request once fewer than 'depth' requests are in flight.
+            * The timeout covers both waiting for a free slot and waiting for the response.
+            *
+            * @return A future of the response. It fails with 'std::errc::timed_out' when the deadline expires,
+            * with 'std::errc::operation_canceled' when the engine stops first and with the reader or writer failure if any.
+            *
+            * @throws std::runtime_error if the request is empty or a request with the same key is in flight.
+            */
+            EXQUDENS_SERIAL_INLINE
+            std::future<std::vector<std::byte>> submit(
+                std::span<const std::byte> request,         //!< A complete request including its key.
+                const std::chrono::milliseconds& timeout    //!< A time limit from now.
+            );
+
+            /*!
+            * Gets the number of requests written and neither answered nor expired.
+            *
+            * @return A number of requests.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getInFlightCount();
+
+            /*!
+            * Gets the number of dropped responses, a late response to an expired request is one of them.
+            *
+            * @return A number of responses.
+            */
+            EXQUDENS_SERIAL_INLINE
+            size_t getUnmatchedCount() const;
+
+            /*!
+            * Stops the reader thread and fails the requests in flight with 'std::errc::operation_canceled'.
+            * Returns within one port read timeout, does nothing if already stopped.
+            */
+            EXQUDENS_SERIAL_INLINE
+            void stop() noexcept;
+
+            /*!
+            * Destructor, calls 'stop'.
+            */
+            EXQUDENS_SERIAL_INLINE
+            ~TransactionEngine() noexcept;
+
+        private:
+
+            void readerLoop();
+
+            void expire();
+
+            void complete(const Key& key, std::span<const std::byte> response);
+
+            void fail(const Key& key, const std::exception_ptr& exception);
+
+            void failAll(const std::exception_ptr& exception);
+
+    };
+
+}
@@ -16,7 +16,27 @@
 #include "TestUtils.hpp"
 
 // include test files
+#include "exqudens/serial/RingBufferUnitTests.hpp"
+#include "exqudens/serial/ByteScannerUnitTests.hpp"
+#include "exqudens/serial/CobsUnitTests.hpp"
+#include "exqudens/serial/SlipUnitTests.hpp"
+#include "exqudens/serial/CrcUnitTests.hpp"
 #include "exqudens/serial/SerialUnitTests.hpp"
+#include "exqudens/serial/SerialHubUnitTests.hpp"
+#include "exqudens/serial/IoUringUnitTests.hpp"
+#include "exqudens/serial/AsyncSerialUnitTests.hpp"
+#include "exqudens/serial/FrameChannelUnitTests.hpp"
+#include "exqudens/serial/PacketChannelUnitTests.hpp"
+#include "exqudens/serial/PortListUnitTests.hpp"
+#include "exqudens/serial/ModbusMasterUnitTests.hpp"
+#include "exqudens/serial/PtyDeviceUnitTests.hpp"
+#include "exqudens/serial/JournalUnitTests.hpp"
+#include "exqudens/serial/PortRegistryUnitTests.hpp"
+#include "exqudens/serial/PortProbeUnitTests.hpp"
+#include "exqudens/serial/Termios2UnitTests.hpp"
+#include "exqudens/serial/TransactionEngineUnitTests.hpp"
+#include "exqudens/serial/BroadcasterUnitTests.hpp"
+#include "exqudens/serial/PortAggregatorUnitTests.hpp"
 #include "exqudens/serial/SerialSystemTests.hpp"
 
 #define CALL_INFO std::string(__FUNCTION__) + "(" + std::filesystem::path(__FILE__).filename().string() + ":" + std::to_string(__LINE__) + ")"
@@ -0,0 +1,193 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/AsyncSerial.hpp"
+#include "exqudens/serial/EventLoop.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class AsyncSerialUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.AsyncSerialUnitTests";
+
+      static std::string toString(std::span<const std::byte> bytes) {
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+      }
+
+  };
+
+  TEST_F(AsyncSerialUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath());
+
+      EventLoop loop;
+      AsyncSerial async(loop, serial, 16);
+
+      std::string data = "hello\nworld\nrest";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      std::vector<std::string> lines;
+      std::string rest;
+      size_t timedOutSize = 1;
+      std::string emptyLine = "not empty";
+      size_t written = 0;
+
+      auto conversation = [&]() -> Task<void> {
+        lines.emplace_back(toString(co_await async.readUntilAsync(std::byte('\n'), 1000)));
+        lines.emplace_back(toString(co_await async.readUntilAsync(std::byte('\n'), 1000)));
+        std::array<std::byte, 16> buffer = {};
+        while (rest.size() < 4) {
+          size_t size = co_await async.readAsync(buffer, 1000);
+          if (size == 0) {
+            break;
+          }
+          rest.append(reinterpret_cast<const char*>(buffer.data()), size);
+        }
+        timedOutSize = co_await async.readAsync(buffer, 50);
+        emptyLine = toString(co_await async.readUntilAsync(std::byte('\n'), 50));
+        std::string ping = "ping";
+        written = co_await async.writeAsync(std::as_bytes(std::span<const char>(ping)), 1000);
+      };
+
+      loop.spawn(conversation());
+
+      ASSERT_EQ(1, loop.getTaskCount());
+
+      loop.run();
+
+      ASSERT_EQ(0, loop.getTaskCount());
+      ASSERT_EQ(std::vector<std::string>({"hello\n", "world\n"}), lines);
+      ASSERT_EQ("rest", rest);
+      ASSERT_EQ(0, timedOutSize);
+      ASSERT_EQ("", emptyLine);
+      ASSERT_EQ(4, written);
+
+      std::vector<unsigned char> echo = pty.read(4, 1000);
+
+      ASSERT_EQ("ping", std::string(echo.begin(), echo.end()));
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(AsyncSerialUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      const size_t portSize = 3;
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::unique_ptr<AsyncSerial>> asyncs;
+      std::vector<std::string> received(portSize);
+      EventLoop loop;
+
+      for (size_t i = 0; i < portSize; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+        serial->open(ptys.back()->getSlavePath());
+        asyncs.emplace_back(std::make_unique<AsyncSerial>(loop, serial));
+      }
+
+      auto receive = [&](size_t i) -> Task<void> {
+        received.at(i) = toString(co_await asyncs.at(i)->readUntilAsync(std::byte('\n'), 2000));
+      };
+      for (size_t i = 0; i < portSize; i++) {
+        loop.spawn(receive(i));
+      }
+
+      std::thread sender([&ptys] {
+        for (size_t i = portSize; i > 0; i--) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          std::string data = "port" + std::to_string(i - 1) + "\n";
+          ptys.at(i - 1)->write(std::vector<unsigned char>(data.begin(), data.end()));
+        }
+      });
+      loop.run();
+      sender.join();
+
+      for (size_t i = 0; i < portSize; i++) {
+        ASSERT_EQ("port" + std::to_string(i) + "\n", received.at(i));
+      }
+
+      auto failing = [&]() -> Task<void> {
+        std::array<std::byte, 1> buffer = {};
+        co_await asyncs.at(0)->readAsync(buffer, 0);
+      };
+      auto waiting = [&]() -> Task<void> {
+        co_await asyncs.at(1)->readUntilAsync(std::byte('\n'), 0);
+      };
+      loop.spawn(waiting());
+      loop.spawn(failing());
+      ptys.at(0).reset();
+
+      ASSERT_THROW(loop.run(), std::runtime_error);
+      ASSERT_EQ(1, loop.getTaskCount());
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(AsyncSerialUnitTests, test3) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath());
+
+      EventLoop loop;
+      AsyncSerial async(loop, serial, 16);
+
+      // A line longer than the read buffer comes in pieces and does not stall the lines after it.
+      std::string data = std::string(20, 'x') + "\nok\n";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      std::vector<std::string> lines;
+      auto conversation = [&]() -> Task<void> {
+        for (size_t i = 0; i < 3; i++) {
+          lines.emplace_back(toString(co_await async.readUntilAsync(std::byte('\n'), 1000)));
+        }
+      };
+      loop.spawn(conversation());
+      loop.run();
+
+      ASSERT_EQ(std::vector<std::string>({std::string(16, 'x'), "xxxx\n", "ok\n"}), lines);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
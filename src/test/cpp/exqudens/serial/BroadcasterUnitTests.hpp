@@ -0,0 +1,86 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/Broadcaster.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class BroadcasterUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.BroadcasterUnitTests";
+
+  };
+
+  TEST_F(BroadcasterUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::shared_ptr<Serial>> ports;
+      for (size_t i = 0; i < 8; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        ports.emplace_back(std::make_shared<Serial>());
+        ports.back()->open(ptys.back()->getSlavePath(), 100);
+      }
+      ports.emplace_back(std::make_shared<Serial>());
+
+      std::vector<unsigned char> payload(4096);
+      for (size_t i = 0; i < payload.size(); i++) {
+        payload.at(i) = static_cast<unsigned char>(i % 251);
+      }
+
+      Broadcaster broadcaster;
+      TEST_LOG_I(LOGGER_ID) << "io_uring: " << broadcaster.isIoUringEnabled();
+      std::vector<Broadcaster::Result> results = broadcaster.broadcast(ports, std::as_bytes(std::span<const unsigned char>(payload)));
+
+      ASSERT_EQ(9, results.size());
+      for (size_t i = 0; i < ptys.size(); i++) {
+        ASSERT_FALSE(results.at(i).error) << results.at(i).error.message();
+        ASSERT_EQ(payload.size(), results.at(i).written);
+        ASSERT_EQ(payload, ptys.at(i)->read(payload.size(), 200));
+      }
+      ASSERT_EQ(std::errc::not_connected, results.back().error);
+      ASSERT_EQ(0, results.back().written);
+
+      results = broadcaster.broadcast(ports, {});
+
+      ASSERT_EQ(0, results.front().written);
+      ASSERT_FALSE(results.front().error);
+
+      std::vector<std::byte> large(1024 * 1024);
+      results = broadcaster.broadcast({ports.front()}, large);
+
+      ASSERT_FALSE(results.front().error);
+      ASSERT_GT(results.front().written, 0);
+      ASSERT_LT(results.front().written, large.size());
+
+      for (std::shared_ptr<Serial>& port : ports) {
+        port->close();
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/ByteScanner.hpp"
+
+namespace exqudens {
+
+  class ByteScannerUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.ByteScannerUnitTests";
+
+  };
+
+  TEST_F(ByteScannerUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      TEST_LOG_I(LOGGER_ID) << "instruction set: '" << ByteScanner::getInstructionSet() << "'";
+
+      std::mt19937 random(7);
+      std::vector<std::byte> bytes(300);
+      for (size_t size = 0; size <= bytes.size(); size++) {
+        for (size_t offset = 0; offset < 3; offset++) {
+          for (std::byte& value : bytes) {
+            value = std::byte(static_cast<unsigned char>(random() % 4));
+          }
+          std::span<const std::byte> view = std::span<const std::byte>(bytes).subspan(offset, std::min(size, bytes.size() - offset));
+          for (unsigned int value = 0; value < 5; value++) {
+            ASSERT_EQ(ByteScanner::findScalar(view, std::byte(value)), ByteScanner::find(view, std::byte(value)));
+            ASSERT_EQ(
+              std::min(ByteScanner::findScalar(view, std::byte(value)), ByteScanner::findScalar(view, std::byte(3))),
+              ByteScanner::findAny(view, std::byte(value), std::byte(3))
+            );
+          }
+        }
+      }
+
+      std::vector<std::byte> zeros(1000, std::byte(0));
+
+      ASSERT_EQ(zeros.size(), ByteScanner::find(zeros, std::byte('\n')));
+
+      zeros.back() = std::byte('\n');
+
+      ASSERT_EQ(zeros.size() - 1, ByteScanner::find(zeros, std::byte('\n')));
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/Cobs.hpp"
+
+namespace exqudens {
+
+  class CobsUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.CobsUnitTests";
+
+      static std::vector<std::byte> toBytes(const std::vector<unsigned int>& values) {
+        std::vector<std::byte> result;
+        for (unsigned int value : values) {
+          result.emplace_back(static_cast<std::byte>(value));
+        }
+        return result;
+      }
+
+      static std::vector<std::byte> encode(std::vector<std::byte> bytes) {
+        size_t size = bytes.size();
+        bytes.resize(Cobs::getMaxEncodedSize(size));
+        bytes.resize(Cobs::encode(bytes, size));
+        return bytes;
+      }
+
+  };
+
+  TEST_F(CobsUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      ASSERT_EQ(toBytes({0x01}), encode({}));
+      ASSERT_EQ(toBytes({0x01, 0x01}), encode(toBytes({0x00})));
+      ASSERT_EQ(toBytes({0x01, 0x01, 0x01}), encode(toBytes({0x00, 0x00})));
+      ASSERT_EQ(toBytes({0x03, 0x11, 0x22, 0x02, 0x33}), encode(toBytes({0x11, 0x22, 0x00, 0x33})));
+      ASSERT_EQ(toBytes({0x02, 0x11, 0x01, 0x01, 0x01}), encode(toBytes({0x11, 0x00, 0x00, 0x00})));
+
+      std::vector<std::byte> full;
+      for (unsigned int i = 1; i <= 254; i++) {
+        full.emplace_back(static_cast<std::byte>(i));
+      }
+      std::vector<std::byte> encoded = encode(full);
+
+      ASSERT_EQ(255, encoded.size());
+      ASSERT_EQ(std::byte(0xFF), encoded.front());
+
+      full.emplace_back(std::byte(0xFF));
+      encoded = encode(full);
+
+      ASSERT_EQ(257, encoded.size());
+      ASSERT_EQ(toBytes({0x02, 0xFF}), std::vector<std::byte>(encoded.end() - 2, encoded.end()));
+
+      std::mt19937 random(11);
+      for (size_t size : {1, 2, 253, 254, 255, 508, 509, 1000, 4096}) {
+        for (unsigned int zeroRate : {1, 8, 1000}) {
+          std::vector<std::byte> payload(size);
+          for (std::byte& value : payload) {
+            value = random() % zeroRate == 0 ? std::byte(0) : static_cast<std::byte>(random() % 255 + 1);
+          }
+          std::vector<std::byte> buffer = encode(payload);
+
+          ASSERT_LE(buffer.size(), Cobs::getMaxEncodedSize(size));
+          ASSERT_EQ(std::find(buffer.begin(), buffer.end(), std::byte(0)), buffer.end());
+
+          buffer.resize(Cobs::decode(buffer));
+
+          ASSERT_EQ(payload, buffer);
+        }
+      }
+
+      std::vector<std::byte> small(3);
+
+      ASSERT_THROW(Cobs::encode(small, 3), std::runtime_error);
+
+      std::vector<std::byte> malformed = toBytes({0x05, 0x11});
+
+      ASSERT_THROW(Cobs::decode(malformed), std::runtime_error);
+
+      malformed = toBytes({0x02, 0x00});
+
+      ASSERT_THROW(Cobs::decode(malformed), std::runtime_error);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
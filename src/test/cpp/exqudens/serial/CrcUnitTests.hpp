@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/Crc.hpp"
+
+namespace exqudens {
+
+  class CrcUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.CrcUnitTests";
+
+      static uint16_t crc16Bitwise(const std::vector<std::byte>& bytes) {
+        uint16_t result = 0xFFFF;
+        for (std::byte value : bytes) {
+          result ^= static_cast<uint16_t>(static_cast<uint16_t>(value) << 8);
+          for (int bit = 0; bit < 8; bit++) {
+            result = static_cast<uint16_t>((result & 0x8000) != 0 ? (result << 1) ^ 0x1021 : result << 1);
+          }
+        }
+        return result;
+      }
+
+      static uint16_t crc16ModbusBitwise(const std::vector<std::byte>& bytes) {
+        uint16_t result = 0xFFFF;
+        for (std::byte value : bytes) {
+          result ^= static_cast<uint16_t>(value);
+          for (int bit = 0; bit < 8; bit++) {
+            result = static_cast<uint16_t>((result & 1) != 0 ? (result >> 1) ^ 0xA001 : result >> 1);
+          }
+        }
+        return result;
+      }
+
+      static uint32_t crc32cBitwise(const std::vector<std::byte>& bytes) {
+        uint32_t result = 0xFFFFFFFF;
+        for (std::byte value : bytes) {
+          result ^= static_cast<uint32_t>(value);
+          for (int bit = 0; bit < 8; bit++) {
+            result = (result & 1) != 0 ? (result >> 1) ^ 0x82F63B78u : result >> 1;
+          }
+        }
+        return ~result;
+      }
+
+  };
+
+  TEST_F(CrcUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      TEST_LOG_I(LOGGER_ID) << "crc32c accelerated: " << Crc::isCrc32cAccelerated();
+
+      std::string check = "123456789";
+      std::span<const std::byte> checkBytes = std::as_bytes(std::span<const char>(check));
+
+      ASSERT_EQ(0x29B1, Crc::crc16(checkBytes));
+      ASSERT_EQ(0x4B37, Crc::crc16Modbus(checkBytes));
+      ASSERT_EQ(0xE3069283u, Crc::crc32c(checkBytes));
+      ASSERT_EQ(0xE3069283u, Crc::crc32cSoftware(checkBytes));
+      ASSERT_EQ(0xFFFF, Crc::crc16({}));
+      ASSERT_EQ(0u, Crc::crc32c({}));
+
+      std::mt19937 random(19);
+      for (size_t size = 0; size < 100; size++) {
+        std::vector<std::byte> bytes(size);
+        for (std::byte& value : bytes) {
+          value = static_cast<std::byte>(random() % 256);
+        }
+        std::span<const std::byte> view(bytes);
+        size_t split = size / 3;
+
+        ASSERT_EQ(crc16Bitwise(bytes), Crc::crc16(view));
+        ASSERT_EQ(crc16ModbusBitwise(bytes), Crc::crc16Modbus(view));
+        ASSERT_EQ(crc32cBitwise(bytes), Crc::crc32c(view));
+        ASSERT_EQ(crc32cBitwise(bytes), Crc::crc32cSoftware(view));
+        ASSERT_EQ(Crc::crc16(view), Crc::crc16(view.subspan(split), Crc::crc16(view.first(split))));
+        ASSERT_EQ(Crc::crc32c(view), Crc::crc32c(view.subspan(split), Crc::crc32c(view.first(split))));
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
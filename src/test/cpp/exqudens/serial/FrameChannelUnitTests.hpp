@@ -0,0 +1,110 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/FrameChannel.hpp"
+#include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/Slip.hpp"
+
+namespace exqudens {
+
+  class FrameChannelUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.FrameChannelUnitTests";
+
+  };
+
+  TEST_F(FrameChannelUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 50);
+      FrameChannel channel(serial, FrameChannel::Codec::COBS, 8);
+
+      // "ab\0c", malformed block, oversized frame, "xy"
+      pty.write({0x03, 'a', 'b', 0x02, 'c', 0x00, 0x07, 'z', 0x00});
+      pty.write({0x0A, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x00, 0x03, 'x', 'y', 0x00});
+
+      std::vector<std::string> frames;
+      auto consumer = [&frames](std::span<const std::byte> frame) {
+        frames.emplace_back(reinterpret_cast<const char*>(frame.data()), frame.size());
+      };
+      for (size_t i = 0; i < 100 && frames.size() < 2; i++) {
+        channel.receive(consumer);
+      }
+
+      ASSERT_EQ(std::vector<std::string>({std::string("ab\0c", 4), "xy"}), frames);
+      ASSERT_EQ(2, channel.getDroppedCount());
+
+      std::string payload("a\0b", 3);
+
+      ASSERT_EQ(5, channel.send(std::as_bytes(std::span<const char>(payload))));
+
+      std::vector<unsigned char> written = pty.read(5, 1000);
+
+      ASSERT_EQ(std::vector<unsigned char>({0x02, 'a', 0x02, 'b', 0x00}), written);
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(FrameChannelUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 50);
+      FrameChannel channel(serial, FrameChannel::Codec::SLIP);
+
+      std::vector<std::string> payloads = {"first", std::string("\xC0\xDB", 2), std::string(1000, 'x')};
+      std::vector<std::string> frames;
+      auto consumer = [&frames](std::span<const std::byte> frame) {
+        frames.emplace_back(reinterpret_cast<const char*>(frame.data()), frame.size());
+      };
+
+      for (const std::string& payload : payloads) {
+        channel.send(std::as_bytes(std::span<const char>(payload)));
+        std::vector<unsigned char> written = pty.read(Slip::getEncodedSize(std::as_bytes(std::span<const char>(payload))), 1000);
+        pty.write(written);
+      }
+      for (size_t i = 0; i < 100 && frames.size() < payloads.size(); i++) {
+        channel.receive(consumer);
+      }
+
+      ASSERT_EQ(payloads, frames);
+      ASSERT_EQ(0, channel.getDroppedCount());
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <array>
+#include <span>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/IoUring.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class IoUringUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.IoUringUnitTests";
+
+  };
+
+  TEST_F(IoUringUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      if (!IoUring::isSupported()) {
+        GTEST_SKIP() << "io_uring is not supported";
+      }
+
+      const size_t portSize = 4;
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::shared_ptr<Serial>> serials;
+      for (size_t i = 0; i < portSize; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        serials.emplace_back(std::make_shared<Serial>());
+        serials.back()->open(ptys.back()->getSlavePath());
+      }
+
+      std::array<std::byte, 64> memory = {};
+      std::array<std::span<std::byte>, 1> buffers = {std::span<std::byte>(memory)};
+      IoUring ring(16);
+      ring.registerBuffers(buffers);
+
+      for (size_t i = 0; i < portSize; i++) {
+        std::string data = "port" + std::to_string(i);
+        ptys.at(i)->write(std::vector<unsigned char>(data.begin(), data.end()));
+      }
+      for (size_t i = 0; i < portSize; i++) {
+        ASSERT_TRUE(ring.prepareReadFixed(serials.at(i)->getNativeHandle(), std::span<std::byte>(memory).subspan(i * 16, 16), 0, i));
+      }
+
+      ASSERT_EQ(portSize, ring.submit(portSize));
+
+      std::array<IoUring::Completion, portSize> completions = {};
+      size_t size = ring.reap(completions);
+
+      ASSERT_EQ(portSize, size);
+
+      for (const IoUring::Completion& completion : completions) {
+        ASSERT_EQ(5, completion.result);
+        std::span<std::byte> bytes = std::span<std::byte>(memory).subspan(completion.userData * 16, 5);
+        ASSERT_EQ("port" + std::to_string(completion.userData), std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+      }
+
+      ring.unregisterBuffers();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
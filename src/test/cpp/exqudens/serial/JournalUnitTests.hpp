@@ -0,0 +1,228 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/AsyncSerial.hpp"
+#include "exqudens/serial/Broadcaster.hpp"
+#include "exqudens/serial/EventLoop.hpp"
+#include "exqudens/serial/Journal.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class JournalUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.JournalUnitTests";
+
+      static std::string getPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("exqudens-serial-" + name + ".journal")).string();
+      }
+
+  };
+
+  TEST_F(JournalUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::string path = getPath(testCase);
+      {
+        Journal journal(path, 1024 * 1024);
+        std::vector<std::thread> threads;
+        for (unsigned char id = 0; id < 4; id++) {
+          threads.emplace_back([&journal, id] {
+            for (unsigned char i = 0; i < 250; i++) {
+              std::byte bytes[3] = {std::byte(id), std::byte(i), std::byte(0xAA)};
+              journal.append(id % 2 == 0 ? Journal::Direction::READ : Journal::Direction::WRITE, std::span<const std::byte>(bytes, 1 + i % 3));
+            }
+          });
+        }
+        for (std::thread& thread : threads) {
+          thread.join();
+        }
+
+        ASSERT_EQ(0, journal.getDroppedCount());
+
+        journal.flush();
+      }
+
+      std::vector<int> next(4, 0);
+      std::vector<std::chrono::nanoseconds> last(4, std::chrono::nanoseconds(0));
+      size_t count = Journal::read(path, [&next, &last](const Journal::Record& record) {
+        size_t id = static_cast<size_t>(record.bytes[0]);
+        ASSERT_LT(id, 4);
+        ASSERT_EQ(id % 2 == 0 ? Journal::Direction::READ : Journal::Direction::WRITE, record.direction);
+        ASSERT_EQ(1 + next.at(id) % 3, record.bytes.size());
+        if (record.bytes.size() > 1) {
+          ASSERT_EQ(next.at(id), static_cast<int>(record.bytes[1]));
+        }
+        ASSERT_GE(record.time, last.at(id));
+        last.at(id) = record.time;
+        next.at(id)++;
+      });
+
+      ASSERT_EQ(1000, count);
+      ASSERT_EQ(std::vector<int>({250, 250, 250, 250}), next);
+
+      {
+        Journal journal(path, 64);
+        std::byte bytes[8] = {};
+
+        ASSERT_TRUE(journal.append(Journal::Direction::READ, bytes));
+        ASSERT_TRUE(journal.append(Journal::Direction::WRITE, bytes));
+        ASSERT_FALSE(journal.append(Journal::Direction::READ, std::span<const std::byte>(bytes, 1)));
+        ASSERT_EQ(1, journal.getDroppedCount());
+      }
+
+      ASSERT_EQ(2, Journal::read(path, [](const Journal::Record&) {}));
+
+      std::filesystem::remove(path);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(JournalUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::string path = getPath(testCase);
+      {
+        std::shared_ptr<Journal> journal = std::make_shared<Journal>(path, 64 * 1024);
+        PtyDevice device;
+        device.startUppercase();
+        std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+        serial->open(device.getSlavePath(), 500);
+        serial->setJournal(journal);
+
+        for (std::string data : {"first", "second"}) {
+          serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+
+          ASSERT_EQ(data.size(), serial->readBytes(data.size()).size());
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+
+        serial->close();
+        device.stop();
+      }
+
+      std::string written;
+      std::string read;
+      Journal::read(path, [&written, &read](const Journal::Record& record) {
+        std::string bytes(reinterpret_cast<const char*>(record.bytes.data()), record.bytes.size());
+        (record.direction == Journal::Direction::WRITE ? written : read) += bytes;
+      });
+
+      ASSERT_EQ("firstsecond", written);
+      ASSERT_EQ("FIRSTSECOND", read);
+
+      PtyDevice device;
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->open(device.getSlavePath(), 1000);
+      device.startReplay(path, 2);
+
+      std::vector<unsigned char> bytes = serial->readBytes(5);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      ASSERT_EQ("FIRST", std::string(bytes.begin(), bytes.end()));
+
+      bytes = serial->readBytes(6);
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      TEST_LOG_I(LOGGER_ID) << "replayed gap: " << elapsed << "s";
+
+      ASSERT_EQ("SECOND", std::string(bytes.begin(), bytes.end()));
+      ASSERT_GE(elapsed, 0.07);
+      ASSERT_LE(elapsed, 0.5);
+
+      device.stop();
+      serial->close();
+      std::filesystem::remove(path);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(JournalUnitTests, test3) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      // I/O on the native handle is recorded too.
+      std::string path = getPath(testCase);
+      {
+        std::shared_ptr<Journal> journal = std::make_shared<Journal>(path, 64 * 1024);
+        PtyDevice device;
+        device.startUppercase();
+        std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+        serial->open(device.getSlavePath(), 500);
+        serial->setJournal(journal);
+
+        EventLoop loop;
+        AsyncSerial async(loop, serial);
+        std::string line;
+        auto conversation = [&]() -> Task<void> {
+          std::string ping = "ping\n";
+          co_await async.writeAsync(std::as_bytes(std::span<const char>(ping)), 1000);
+          std::span<const std::byte> bytes = co_await async.readUntilAsync(std::byte('\n'), 1000);
+          line.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        };
+        loop.spawn(conversation());
+        loop.run();
+
+        ASSERT_EQ("PING\n", line);
+
+        Broadcaster broadcaster;
+        std::string payload = "all";
+        std::vector<Broadcaster::Result> results = broadcaster.broadcast({serial}, std::as_bytes(std::span<const char>(payload)));
+
+        ASSERT_EQ(payload.size(), results.at(0).written);
+
+        serial->close();
+        device.stop();
+      }
+
+      std::string written;
+      std::string read;
+      Journal::read(path, [&written, &read](const Journal::Record& record) {
+        std::string bytes(reinterpret_cast<const char*>(record.bytes.data()), record.bytes.size());
+        (record.direction == Journal::Direction::WRITE ? written : read) += bytes;
+      });
+
+      ASSERT_EQ("ping\nall", written);
+      ASSERT_EQ("PING\n", read);
+
+      std::filesystem::remove(path);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,213 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Crc.hpp"
+#include "exqudens/serial/ModbusMaster.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class ModbusMasterUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.ModbusMasterUnitTests";
+
+      /*!
+      * Simulated bus: slave 1 serves registers (initial value is twice the address),
+      * slave 2 answers with exception 2, slave 3 is silent, slave 4 answers with a bad CRC,
+      * slave 5 pauses inside its response for longer than t1.5 and slave 6 answers with a single byte.
+      */
+      class SlaveSimulator {
+
+        private:
+
+          PtyDevice& pty;
+          std::atomic<bool> stopped = false;
+          std::thread thread;
+
+        public:
+
+          std::map<uint16_t, uint16_t> registers;
+          std::map<uint8_t, size_t> requestCounts;
+
+          explicit SlaveSimulator(PtyDevice& pty): pty(pty) {
+            thread = std::thread(&SlaveSimulator::run, this);
+          }
+
+          void stop() {
+            stopped.store(true);
+            if (thread.joinable()) {
+              thread.join();
+            }
+          }
+
+          ~SlaveSimulator() {
+            stop();
+          }
+
+        private:
+
+          static void appendCrc(std::vector<unsigned char>& frame) {
+            uint16_t crc = Crc::crc16Modbus(std::as_bytes(std::span<const unsigned char>(frame)));
+            frame.emplace_back(static_cast<unsigned char>(crc & 0xFF));
+            frame.emplace_back(static_cast<unsigned char>(crc >> 8));
+          }
+
+          void run() {
+            while (!stopped.load()) {
+              std::vector<unsigned char> request = pty.read(7, 10);
+              if (request.size() < 7) {
+                continue;
+              }
+              std::vector<unsigned char> tail = pty.read(request.at(1) == 16 ? request.at(6) + 2 : 1, 100);
+              request.insert(request.end(), tail.begin(), tail.end());
+              uint8_t slave = request.at(0);
+              uint8_t function = request.at(1);
+              uint16_t address = static_cast<uint16_t>((request.at(2) << 8) | request.at(3));
+              uint16_t count = static_cast<uint16_t>((request.at(4) << 8) | request.at(5));
+              requestCounts[slave]++;
+
+              std::vector<unsigned char> response = {slave};
+              if (slave == 1 && (function == 3 || function == 4)) {
+                response.emplace_back(function);
+                response.emplace_back(static_cast<unsigned char>(count * 2));
+                for (uint16_t i = 0; i < count; i++) {
+                  uint16_t key = static_cast<uint16_t>(address + i);
+                  uint16_t value = registers.contains(key) ? registers.at(key) : static_cast<uint16_t>(key * 2);
+                  response.emplace_back(static_cast<unsigned char>(value >> 8));
+                  response.emplace_back(static_cast<unsigned char>(value & 0xFF));
+                }
+              } else if (slave == 1 && function == 6) {
+                registers[address] = count;
+                response.assign(request.begin(), request.begin() + 6);
+              } else if (slave == 1 && function == 16) {
+                for (uint16_t i = 0; i < count; i++) {
+                  registers[static_cast<uint16_t>(address + i)] = static_cast<uint16_t>((request.at(7 + i * 2) << 8) | request.at(8 + i * 2));
+                }
+                response.assign(request.begin(), request.begin() + 6);
+              } else if (slave == 2) {
+                response.emplace_back(static_cast<unsigned char>(function | 0x80));
+                response.emplace_back(0x02);
+              } else if (slave == 3) {
+                continue;
+              } else if (slave == 6) {
+                pty.write({slave});
+                continue;
+              } else {
+                response = {slave, function, 0x02, 0x00, 0x01};
+              }
+              appendCrc(response);
+              if (slave == 4) {
+                response.back() ^= 0xFF;
+              }
+              if (slave == 5) {
+                pty.write(std::vector<unsigned char>(response.begin(), response.begin() + 3));
+                std::this_thread::sleep_for(std::chrono::microseconds(3000));
+                response.erase(response.begin(), response.begin() + 3);
+              }
+              pty.write(response);
+            }
+          }
+
+      };
+
+  };
+
+  TEST_F(ModbusMasterUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      ASSERT_EQ(std::chrono::nanoseconds(1718750), ModbusMaster(std::make_shared<Serial>(), 9600).getCharacterGap());
+      ASSERT_EQ(std::chrono::nanoseconds(4010416), ModbusMaster(std::make_shared<Serial>(), 9600).getFrameGap());
+      ASSERT_EQ(std::chrono::microseconds(1750), ModbusMaster(std::make_shared<Serial>(), 115200).getFrameGap());
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 50);
+      SlaveSimulator simulator(pty);
+      // At 9600 baud t1.5 is 1.72 ms and t3.5 is 4.01 ms, the pause of slave 5 lies well between them.
+      ModbusMaster master(serial, 9600, 11, std::chrono::milliseconds(500));
+
+      std::vector<uint16_t> values = master.readHoldingRegisters(1, 10, 3);
+
+      ASSERT_EQ(std::vector<uint16_t>({20, 22, 24}), values);
+
+      values = master.readInputRegisters(1, 0, 300);
+
+      ASSERT_EQ(300, values.size());
+      ASSERT_EQ(598, values.back());
+      ASSERT_EQ(4, simulator.requestCounts[1]);
+
+      master.writeSingleRegister(1, 5, 0xBEEF);
+      std::vector<uint16_t> written = {7, 8, 9};
+      master.writeMultipleRegisters(1, 100, written);
+
+      std::map<uint16_t, uint16_t> scattered = master.readHoldingRegisters(1, {205, 5, 1, 100, 102, 200}, 8);
+
+      std::map<uint16_t, uint16_t> expected = {{1, 2}, {5, 0xBEEF}, {100, 7}, {102, 9}, {200, 400}, {205, 410}};
+
+      ASSERT_EQ(expected, scattered);
+      ASSERT_EQ(9, simulator.requestCounts[1]);
+
+      ASSERT_THROW(master.readHoldingRegisters(2, 0, 1), std::runtime_error);
+
+      std::vector<ModbusMaster::Request> requests = {
+        {.slave = 1, .function = 3, .address = 0, .count = 2},
+        {.slave = 2, .function = 3, .address = 0, .count = 2},
+        {.slave = 3, .function = 4, .address = 0, .count = 2},
+        {.slave = 4, .function = 3, .address = 0, .count = 1},
+        {.slave = 5, .function = 3, .address = 0, .count = 1},
+        {.slave = 6, .function = 3, .address = 0, .count = 1},
+        {.slave = 1, .function = 4, .address = 1, .count = 1}
+      };
+      std::vector<ModbusMaster::Response> responses = master.poll(requests);
+
+      ASSERT_EQ(7, responses.size());
+      ASSERT_EQ(std::vector<uint16_t>({0, 2}), responses.at(0).values);
+      ASSERT_EQ(2, responses.at(1).exceptionCode);
+      ASSERT_TRUE(responses.at(2).timedOut);
+      ASSERT_FALSE(responses.at(2).corrupted);
+      for (size_t i = 3; i < 6; i++) {
+        ASSERT_TRUE(responses.at(i).corrupted) << "slave: " << static_cast<int>(responses.at(i).slave);
+        ASSERT_FALSE(responses.at(i).timedOut);
+      }
+      ASSERT_EQ(std::vector<uint16_t>({2}), responses.at(6).values);
+      ASSERT_FALSE(responses.at(6).timedOut);
+      ASSERT_FALSE(responses.at(6).corrupted);
+
+      // A short reply ends with the t3.5 gap, not with the response timeout.
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      ASSERT_THROW(master.readHoldingRegisters(6, 0, 1), std::runtime_error);
+      ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(250));
+
+      simulator.stop();
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/PacketChannel.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class PacketChannelUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PacketChannelUnitTests";
+
+  };
+
+  TEST_F(PacketChannelUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      for (PacketChannel::Checksum checksum : {PacketChannel::Checksum::CRC16, PacketChannel::Checksum::CRC32C}) {
+        PtyDevice pty;
+        std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+        serial->open(pty.getSlavePath(), 50);
+        PacketChannel channel(serial, checksum, 64);
+
+        std::vector<std::string> payloads = {"first", "", std::string(64, 'x'), "~~~", "last"};
+        std::vector<std::vector<unsigned char>> packets;
+        for (const std::string& payload : payloads) {
+          channel.send(std::as_bytes(std::span<const char>(payload)));
+          packets.emplace_back(pty.read(payload.size() + (checksum == PacketChannel::Checksum::CRC16 ? 5 : 7), 1000));
+        }
+
+        // noise, a packet with a flipped payload bit, a truncated packet and a bad length before valid packets
+        std::vector<unsigned char> corrupted = packets.at(0);
+        corrupted.at(4) ^= 0x01;
+        pty.write({0x01, 0x7E, 0x02});
+        pty.write(packets.at(0));
+        pty.write(corrupted);
+        pty.write(packets.at(1));
+        pty.write(std::vector<unsigned char>(packets.at(2).begin(), packets.at(2).begin() + 10));
+        pty.write({0x7E, 0xFF, 0xFF});
+        for (size_t i = 2; i < packets.size(); i++) {
+          pty.write(packets.at(i));
+        }
+
+        std::vector<std::string> received;
+        auto handler = [&received](std::span<const std::byte> payload) {
+          received.emplace_back(reinterpret_cast<const char*>(payload.data()), payload.size());
+        };
+        for (size_t i = 0; i < 100 && received.size() < payloads.size(); i++) {
+          channel.receive(handler);
+        }
+
+        TEST_LOG_I(LOGGER_ID) << "corrupted: " << channel.getCorruptedCount() << " skipped: " << channel.getSkippedCount();
+
+        ASSERT_EQ(payloads, received);
+        ASSERT_LE(3, channel.getCorruptedCount());
+        ASSERT_LE(corrupted.size() + 10 + 6, channel.getSkippedCount());
+
+        serial->close();
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
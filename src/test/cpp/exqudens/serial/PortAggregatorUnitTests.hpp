@@ -0,0 +1,176 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PortAggregator.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class PortAggregatorUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PortAggregatorUnitTests";
+
+  };
+
+  TEST_F(PortAggregatorUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::shared_ptr<Serial>> ports;
+      for (size_t i = 0; i < 3; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        ports.emplace_back(std::make_shared<Serial>());
+        ports.back()->open(ptys.back()->getSlavePath(), 100);
+      }
+
+      ASSERT_THROW(PortAggregator({}), std::runtime_error);
+      ASSERT_THROW(PortAggregator({std::make_shared<Serial>()}), std::runtime_error);
+
+      PortAggregator aggregator(ports);
+      std::vector<std::pair<size_t, unsigned char>> script = {{0, 'a'}, {2, 'b'}, {1, 'c'}, {0, 'd'}, {1, 'e'}, {2, 'f'}};
+      for (const std::pair<size_t, unsigned char>& step : script) {
+        ptys.at(step.first)->write({step.second});
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+
+      std::vector<std::pair<size_t, unsigned char>> received;
+      std::vector<std::chrono::steady_clock::time_point> times;
+      while (received.size() < script.size()) {
+        size_t count = aggregator.wait([&](const PortAggregator::Chunk& chunk) {
+          for (std::byte value : chunk.bytes) {
+            received.emplace_back(chunk.port, static_cast<unsigned char>(value));
+            times.emplace_back(chunk.time);
+          }
+        }, std::chrono::milliseconds(1000));
+        ASSERT_GT(count, 0);
+      }
+
+      ASSERT_EQ(script, received);
+      for (size_t i = 1; i < times.size(); i++) {
+        ASSERT_LT(times.at(i - 1), times.at(i));
+      }
+      ASSERT_EQ(0, aggregator.wait([](const PortAggregator::Chunk&) {}, std::chrono::milliseconds(20)));
+      for (size_t i = 0; i < ports.size(); i++) {
+        ASSERT_EQ(nullptr, aggregator.getPortException(i));
+      }
+
+      aggregator.stop();
+      for (std::shared_ptr<Serial>& port : ports) {
+        port->close();
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PortAggregatorUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::vector<unsigned char> pattern(251);
+      for (size_t i = 0; i < pattern.size(); i++) {
+        pattern.at(i) = static_cast<unsigned char>(i);
+      }
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::shared_ptr<Serial>> ports;
+      for (size_t i = 0; i < 4; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        ports.emplace_back(std::make_shared<Serial>());
+        ports.back()->open(ptys.back()->getSlavePath(), 100);
+      }
+
+      PortAggregator aggregator(ports, 64, 16);
+      for (std::unique_ptr<PtyDevice>& pty : ptys) {
+        pty->startStream(pattern, 0);
+      }
+
+      std::vector<size_t> counts(ports.size());
+      std::vector<unsigned char> expected(ports.size());
+      std::chrono::steady_clock::time_point last;
+      bool ordered = true;
+      bool continuous = true;
+      PortAggregator::Handler handler = [&](const PortAggregator::Chunk& chunk) {
+        ordered = ordered && last <= chunk.time;
+        last = chunk.time;
+        for (std::byte value : chunk.bytes) {
+          continuous = continuous && static_cast<unsigned char>(value) == expected.at(chunk.port);
+          expected.at(chunk.port) = static_cast<unsigned char>((static_cast<size_t>(expected.at(chunk.port)) + 1) % pattern.size());
+        }
+        counts.at(chunk.port) += chunk.bytes.size();
+      };
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+      while (std::chrono::steady_clock::now() < end) {
+        aggregator.wait(handler, std::chrono::milliseconds(100));
+      }
+      TEST_LOG_I(LOGGER_ID) << "received: " << counts.at(0) << ", " << counts.at(1) << ", " << counts.at(2) << ", " << counts.at(3);
+
+      ASSERT_TRUE(ordered);
+      ASSERT_TRUE(continuous);
+      for (size_t count : counts) {
+        ASSERT_GT(count, 0);
+      }
+
+      // A hung up port fails alone, the merge goes on with the others.
+      ptys.front().reset();
+      end = std::chrono::steady_clock::now() + std::chrono::milliseconds(1000);
+      while (aggregator.getPortException(0) == nullptr && std::chrono::steady_clock::now() < end) {
+        aggregator.wait(handler, std::chrono::milliseconds(10));
+      }
+
+      ASSERT_NE(nullptr, aggregator.getPortException(0));
+      try {
+        std::rethrow_exception(aggregator.getPortException(0));
+      } catch (const std::exception& e) {
+        TEST_LOG_I(LOGGER_ID) << "port failure: " << TestUtils::toString(e);
+      }
+
+      size_t before = counts.at(1);
+      end = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+      while (std::chrono::steady_clock::now() < end) {
+        aggregator.wait(handler, std::chrono::milliseconds(10));
+      }
+
+      ASSERT_GT(counts.at(1), before);
+      ASSERT_TRUE(ordered);
+      ASSERT_TRUE(continuous);
+
+      aggregator.stop();
+      for (size_t i = 1; i < ptys.size(); i++) {
+        ptys.at(i)->stop();
+      }
+      for (std::shared_ptr<Serial>& port : ports) {
+        port->close();
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PortList.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class PortListUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PortListUnitTests";
+
+  };
+
+  TEST_F(PortListUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      uint16_t vendorId = 0;
+      uint16_t productId = 0;
+
+      ASSERT_TRUE(PortList::parseUsbId("USB VID:PID=0483:5740 SNR=205B3A8A5748", vendorId, productId));
+      ASSERT_EQ(0x0483, vendorId);
+      ASSERT_EQ(0x5740, productId);
+      ASSERT_TRUE(PortList::parseUsbId("USB\\VID_10C4&PID_EA60\\0001", vendorId, productId));
+      ASSERT_EQ(0x10C4, vendorId);
+      ASSERT_EQ(0xEA60, productId);
+      ASSERT_FALSE(PortList::parseUsbId("PNP0501", vendorId, productId));
+      ASSERT_FALSE(PortList::parseUsbId("USB VID:PID=04", vendorId, productId));
+      ASSERT_EQ(0x10C4, vendorId);
+
+      PortList ports;
+      ports.reserve(2, 8);
+      for (int i = 0; i < 64; i++) {
+        char hardwareId[32] = {};
+        std::snprintf(hardwareId, sizeof(hardwareId), "USB VID:PID=0483:%04X", 0x5700 + i);
+        ASSERT_TRUE(ports.add("/dev/ttyUSB" + std::to_string(i), "device\t" + std::to_string(i) + "\x01", hardwareId));
+      }
+      ASSERT_FALSE(ports.add("/dev/ttyS0", "n/a", "PNP0501", [](const PortInfo& port) { return port.vendorId != 0; }));
+
+      ASSERT_EQ(64, ports.size());
+      for (int i = 0; i < 64; i++) {
+        ASSERT_EQ("/dev/ttyUSB" + std::to_string(i), ports.at(i).port);
+        ASSERT_EQ("device " + std::to_string(i), ports.at(i).description);
+        ASSERT_EQ(0x0483, ports.at(i).vendorId);
+        ASSERT_EQ(0x5700 + i, ports.at(i).productId);
+      }
+
+      PortList copy = ports;
+      ports = PortList();
+
+      ASSERT_TRUE(ports.empty());
+      ASSERT_EQ(64, copy.size());
+      ASSERT_EQ("/dev/ttyUSB63", copy.at(63).port);
+      ASSERT_EQ("USB VID:PID=0483:573F", copy.at(63).hardwareId);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PortListUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+
+      PortList ports = serial->findPorts();
+      for (const PortInfo& port : ports) {
+        TEST_LOG_I(LOGGER_ID) << "port: '" << port.port << "' hardware-id: '" << port.hardwareId << "'";
+      }
+
+      ASSERT_EQ(serial->listPorts().size(), ports.size());
+      ASSERT_TRUE(serial->findPorts([](const PortInfo&) { return false; }).empty());
+      ASSERT_EQ(ports.size(), serial->findPorts(std::regex(".*")).size());
+      ASSERT_TRUE(serial->findPorts(std::regex("^no such port$")).empty());
+
+      size_t usbCount = 0;
+      for (const PortInfo& port : ports) {
+        if (port.vendorId == 0x0483 && port.productId == 0x5740) {
+          usbCount++;
+        }
+      }
+
+      ASSERT_EQ(usbCount, serial->findPorts(0x0483, 0x5740).size());
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
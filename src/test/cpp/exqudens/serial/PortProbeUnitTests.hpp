@@ -0,0 +1,96 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PortProbe.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+
+namespace exqudens {
+
+  class PortProbeUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PortProbeUnitTests";
+
+      static std::optional<std::string> identify(ISerial& serial, const PortInfo&) {
+        std::string request = "id?";
+        serial.writeBytes(std::vector<unsigned char>(request.begin(), request.end()));
+        std::vector<unsigned char> bytes = serial.readBytes(3);
+        std::string response(bytes.begin(), bytes.end());
+        if (response == "GPS") {
+          return "gps";
+        }
+        if (response == "ID?") {
+          return "upper";
+        }
+        return std::nullopt;
+      }
+
+  };
+
+  TEST_F(PortProbeUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::vector<std::unique_ptr<PtyDevice>> devices;
+      PortList ports;
+      for (size_t i = 0; i < 12; i++) {
+        std::unique_ptr<PtyDevice> device = std::make_unique<PtyDevice>();
+        if (i % 3 == 0) {
+          device->startScript({{{'i', 'd', '?'}, {'G', 'P', 'S'}}});
+        } else if (i % 3 == 1) {
+          device->startUppercase();
+        }
+        ports.add(device->getSlavePath(), "pty", "");
+        devices.emplace_back(std::move(device));
+      }
+      ports.add("/dev/ttyNOTHERE", "missing", "");
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      std::vector<PortProbe::Match> matches = PortProbe(16, 300).probePorts(ports, identify);
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      TEST_LOG_I(LOGGER_ID) << "probed " << ports.size() << " ports with 16 workers in " << elapsed << "s";
+
+      ASSERT_EQ(8, matches.size());
+      for (size_t i = 0; i < matches.size(); i++) {
+        size_t device = i / 2 * 3 + i % 2;
+        ASSERT_EQ(devices.at(device)->getSlavePath(), matches.at(i).port);
+        ASSERT_EQ(device % 3 == 0 ? "gps" : "upper", matches.at(i).identity);
+      }
+      ASSERT_LT(elapsed, 0.9);
+
+      start = std::chrono::steady_clock::now();
+      matches = PortProbe(2, 300).probePorts(ports, identify);
+      elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      TEST_LOG_I(LOGGER_ID) << "probed " << ports.size() << " ports with 2 workers in " << elapsed << "s";
+
+      ASSERT_EQ(8, matches.size());
+      ASSERT_GE(elapsed, 0.6);
+
+      for (std::unique_ptr<PtyDevice>& device : devices) {
+        device->stop();
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PortRegistry.hpp"
+
+namespace exqudens {
+
+  class PortRegistryUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PortRegistryUnitTests";
+
+      static PortList listPorts(const std::filesystem::path& directory) {
+        PortList result;
+        for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory)) {
+          if (entry.path().filename().string().starts_with("tty")) {
+            result.add(entry.path().string(), "test", "USB VID:PID=0483:5740");
+          }
+        }
+        return result;
+      }
+
+  };
+
+  TEST_F(PortRegistryUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::filesystem::path directory = std::filesystem::temp_directory_path() / ("exqudens-serial-" + testCase);
+      std::filesystem::remove_all(directory);
+      std::filesystem::create_directories(directory);
+      std::ofstream(directory / "ttyTEST0").close();
+
+      PortRegistry registry(directory.string(), [&directory] { return listPorts(directory); });
+
+      ASSERT_EQ(1, registry.getEnumerationCount());
+      ASSERT_EQ(1, registry.getSnapshot()->size());
+      ASSERT_EQ((directory / "ttyTEST0").string(), registry.getSnapshot()->at(0).port);
+      ASSERT_EQ(0x0483, registry.getSnapshot()->at(0).vendorId);
+
+      std::mutex mutex;
+      std::condition_variable condition;
+      std::vector<std::string> events;
+      size_t id = registry.subscribe([&mutex, &condition, &events](
+          const PortRegistry::Snapshot& snapshot,
+          const std::vector<PortInfo>& added,
+          const std::vector<PortInfo>& removed
+      ) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const PortInfo& port : added) {
+          events.emplace_back("+" + std::filesystem::path(port.port).filename().string());
+        }
+        for (const PortInfo& port : removed) {
+          events.emplace_back("-" + std::filesystem::path(port.port).filename().string());
+        }
+        condition.notify_all();
+      });
+      auto waitFor = [&mutex, &condition, &events](const size_t& count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return condition.wait_for(lock, std::chrono::seconds(2), [&events, &count] { return events.size() >= count; });
+      };
+
+      PortRegistry::Snapshot before = registry.getSnapshot();
+      std::ofstream(directory / "other").close();
+      std::ofstream(directory / "ttyTEST1").close();
+
+      ASSERT_TRUE(waitFor(1));
+      ASSERT_EQ(std::vector<std::string>({"+ttyTEST1"}), events);
+      ASSERT_EQ(2, registry.getEnumerationCount());
+      ASSERT_EQ(2, registry.getSnapshot()->size());
+      ASSERT_EQ(1, before->size());
+
+      size_t enumerationCount = registry.getEnumerationCount();
+      std::filesystem::remove(directory / "ttyTEST0");
+
+      ASSERT_TRUE(waitFor(2));
+      ASSERT_EQ(std::vector<std::string>({"+ttyTEST1", "-ttyTEST0"}), events);
+      ASSERT_EQ(enumerationCount, registry.getEnumerationCount());
+      ASSERT_EQ(1, registry.getSnapshot()->size());
+      ASSERT_EQ((directory / "ttyTEST1").string(), registry.getSnapshot()->at(0).port);
+      ASSERT_EQ(0x5740, registry.getSnapshot()->at(0).productId);
+
+      registry.unsubscribe(id);
+      std::filesystem::remove(directory / "ttyTEST1");
+      registry.refresh();
+
+      ASSERT_TRUE(registry.getSnapshot()->empty());
+      ASSERT_EQ(2, events.size());
+
+      std::filesystem::remove_all(directory);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,121 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+
+namespace exqudens {
+
+  class PtyDeviceUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.PtyDeviceUnitTests";
+
+  };
+
+  TEST_F(PtyDeviceUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice device;
+      device.startUppercase();
+
+      ASSERT_TRUE(device.isRunning());
+
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(device.getSlavePath(), 500);
+
+      ASSERT_EQ(0, serial->readBytes(5).size());
+
+      std::string data = "hello";
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      std::vector<unsigned char> bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ("HELLO", std::string(bytes.begin(), bytes.end()));
+
+      device.stop();
+
+      ASSERT_FALSE(device.isRunning());
+      ASSERT_EQ(5, device.getReceivedCount());
+      ASSERT_EQ(5, device.getSentCount());
+
+      device.startEcho();
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ("hello", std::string(bytes.begin(), bytes.end()));
+      ASSERT_THROW(device.startEcho(), std::runtime_error);
+
+      device.stop();
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PtyDeviceUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice device;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(device.getSlavePath(), 50);
+
+      device.startStream({'a', 'b', 'c'}, 2000);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      std::string received;
+      while (received.size() < 600) {
+        std::vector<unsigned char> bytes = serial->readBytes(600 - received.size());
+        received.append(bytes.begin(), bytes.end());
+      }
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      device.stop();
+      while (!serial->readBytes(64).empty()) {
+        // drain bytes streamed before the stop
+      }
+      TEST_LOG_I(LOGGER_ID) << "streamed 600 bytes in: " << elapsed << "s";
+
+      ASSERT_EQ("abcabc", received.substr(0, 6));
+      ASSERT_EQ("abc", received.substr(597, 3));
+      ASSERT_GE(elapsed, 0.25);
+      ASSERT_LE(elapsed, 2.0);
+
+      device.startScript({
+        PtyDevice::Exchange {.request = {'A', 'T', '\r'}, .response = {'O', 'K', '\r', '\n'}},
+        PtyDevice::Exchange {.request = {'A', 'T', 'I', '\r'}, .response = {'P', 't', 'y', '\r', '\n'}}
+      });
+      std::string data = "noise ATI\rAT\r";
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      std::vector<unsigned char> bytes = serial->readBytes(9);
+
+      ASSERT_EQ("Pty\r\nOK\r\n", std::string(bytes.begin(), bytes.end()));
+
+      device.stop();
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/RingBuffer.hpp"
+
+namespace exqudens {
+
+  class RingBufferUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.RingBufferUnitTests";
+
+  };
+
+  TEST_F(RingBufferUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      RingBuffer buffer(6);
+
+      ASSERT_EQ(8, buffer.getCapacity());
+
+      std::array<std::byte, 6> input = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}, std::byte{5}, std::byte{6}};
+      std::array<std::byte, 8> output = {};
+
+      ASSERT_EQ(6, buffer.write(input));
+      ASSERT_EQ(4, buffer.read(std::span<std::byte>(output).first(4)));
+      ASSERT_EQ(6, buffer.write(input));
+      ASSERT_EQ(8, buffer.size());
+      ASSERT_EQ(0, buffer.getOverflowCount());
+      ASSERT_EQ(8, buffer.getHighWaterMark());
+
+      ASSERT_EQ(0, buffer.write(input));
+      ASSERT_EQ(6, buffer.getOverflowCount());
+
+      ASSERT_EQ(8, buffer.read(output));
+      std::array<std::byte, 8> expected = {std::byte{5}, std::byte{6}, std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}, std::byte{5}, std::byte{6}};
+      ASSERT_EQ(expected, output);
+      ASSERT_EQ(0, buffer.size());
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(RingBufferUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      RingBuffer buffer(64);
+      const size_t total = 100000;
+
+      std::thread producer([&buffer, total] {
+        size_t value = 0;
+        while (value < total) {
+          std::span<std::byte> region = buffer.writableRegion();
+          size_t length = std::min(region.size(), total - value);
+          for (size_t i = 0; i < length; i++) {
+            region[i] = static_cast<std::byte>(value++);
+          }
+          buffer.commitWrite(length);
+          if (length == 0) {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      size_t value = 0;
+      bool ordered = true;
+      std::array<std::byte, 48> output = {};
+      while (value < total) {
+        size_t length = buffer.read(output);
+        for (size_t i = 0; i < length; i++) {
+          ordered = ordered && output[i] == static_cast<std::byte>(value++);
+        }
+        if (length == 0) {
+          std::this_thread::yield();
+        }
+      }
+      producer.join();
+
+      ASSERT_TRUE(ordered);
+      ASSERT_EQ(0, buffer.getOverflowCount());
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
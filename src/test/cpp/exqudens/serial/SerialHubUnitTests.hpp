@@ -0,0 +1,109 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/SerialHub.hpp"
+
+namespace exqudens {
+
+  class SerialHubUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.SerialHubUnitTests";
+
+  };
+
+  TEST_F(SerialHubUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      const size_t portSize = 4;
+      std::vector<std::unique_ptr<PtyDevice>> ptys;
+      std::vector<std::shared_ptr<Serial>> serials;
+      std::vector<std::string> received(portSize);
+      std::vector<size_t> ids;
+      std::optional<size_t> failed;
+      std::mutex mutex;
+      std::condition_variable condition;
+
+      SerialHub hub(2);
+
+      ASSERT_EQ(2, hub.getThreadCount());
+
+      for (size_t i = 0; i < portSize; i++) {
+        ptys.emplace_back(std::make_unique<PtyDevice>());
+        serials.emplace_back(std::make_shared<Serial>());
+        serials.back()->open(ptys.back()->getSlavePath());
+        ids.emplace_back(hub.add(serials.back(), SerialHub::Handler {
+          .onRead = [i, &received, &mutex, &condition](std::span<const std::byte> bytes) {
+            std::lock_guard<std::mutex> lock(mutex);
+            received.at(i).append(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            condition.notify_all();
+          },
+          .onWritable = {},
+          .onError = [i, &failed, &mutex, &condition](const std::exception_ptr&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            failed = i;
+            condition.notify_all();
+          }
+        }));
+      }
+
+      ASSERT_EQ(portSize, hub.getPortCount());
+
+      for (size_t i = 0; i < portSize; i++) {
+        std::string data = "port" + std::to_string(i);
+        ptys.at(i)->write(std::vector<unsigned char>(data.begin(), data.end()));
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait_for(lock, std::chrono::seconds(2), [&received] {
+          return std::ranges::all_of(received, [](const std::string& value) { return value.size() == 5; });
+        });
+      }
+
+      for (size_t i = 0; i < portSize; i++) {
+        ASSERT_EQ("port" + std::to_string(i), received.at(i));
+      }
+
+      hub.remove(ids.at(0));
+
+      ASSERT_EQ(portSize - 1, hub.getPortCount());
+
+      ptys.at(1).reset();
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait_for(lock, std::chrono::seconds(2), [&failed] { return failed.has_value(); });
+      }
+
+      ASSERT_EQ(1, failed.value_or(0));
+      ASSERT_EQ(portSize - 2, hub.getPortCount());
+
+      hub.stop();
+
+      ASSERT_EQ(0, hub.getPortCount());
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
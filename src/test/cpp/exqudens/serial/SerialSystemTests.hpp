@@ -29,12 +29,10 @@ namespace exqudens {
 
       std::optional<std::string> port = {};
 
-      std::vector<std::map<std::string, std::string>> ports = serial->listPorts();
-      for (const std::map<std::string, std::string>& entry : ports) {
-        TEST_LOG_I(LOGGER_ID) << TestUtils::toString(entry);
-        if (entry.contains("port") && entry.contains("hardware-id") && entry.at("hardware-id").starts_with("USB\\VID_0483&PID_5740")) {
-          port.emplace(entry.at("port"));
-        }
+      PortList ports = serial->findPorts(0x0483, 0x5740);
+      for (const PortInfo& entry : ports) {
+        TEST_LOG_I(LOGGER_ID) << "port: '" << entry.port << "' hardware-id: '" << entry.hardwareId << "'";
+        port.emplace(entry.port);
       }
 
       ASSERT_TRUE(port.has_value());
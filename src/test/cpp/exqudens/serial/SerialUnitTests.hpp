@@ -1,10 +1,22 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iterator>
+#include <future>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "TestLogging.hpp"
 #include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
 #include "exqudens/serial/Serial.hpp"
 
 namespace exqudens {
@@ -36,4 +48,564 @@ namespace exqudens {
     }
   }
 
+#if defined(__linux__)
+  TEST_F(SerialUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 500);
+
+      std::string data = "hello";
+      size_t length = serial->writeFrom(std::as_bytes(std::span<const char>(data)));
+      TEST_LOG_I(LOGGER_ID) << "sent length: " << length;
+
+      ASSERT_EQ(5, length);
+      ASSERT_EQ(std::vector<unsigned char>(data.begin(), data.end()), pty.read(5, 500));
+
+      std::string head = "head:";
+      std::string body = "body";
+      std::array<std::span<const std::byte>, 2> buffers = {
+        std::as_bytes(std::span<const char>(head)),
+        std::as_bytes(std::span<const char>(body))
+      };
+      length = serial->writeFrom(buffers);
+
+      ASSERT_EQ(9, length);
+      std::vector<unsigned char> received = pty.read(9, 500);
+      ASSERT_EQ(std::string("head:body"), std::string(received.begin(), received.end()));
+
+      data = "HELLO";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+      std::array<std::byte, 5> buffer = {};
+      length = serial->readInto(buffer);
+      TEST_LOG_I(LOGGER_ID) << "received length: " << length;
+
+      ASSERT_EQ(5, length);
+      ASSERT_EQ(data, std::string(reinterpret_cast<const char*>(buffer.data()), length));
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test3) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 50);
+      serial->startReader(16);
+
+      ASSERT_TRUE(serial->isReaderRunning());
+      ASSERT_TRUE(serial->readBytes(5).empty());
+
+      std::string data = "hello";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+      std::string received;
+      for (size_t i = 0; i < 100 && received.size() < data.size(); i++) {
+        std::vector<unsigned char> bytes = serial->readBytes(data.size() - received.size());
+        received += std::string(bytes.begin(), bytes.end());
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      TEST_LOG_I(LOGGER_ID) << "received: '" << received << "'";
+
+      ASSERT_EQ(data, received);
+
+      data = std::string(40, 'x');
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+      for (size_t i = 0; i < 100 && serial->getReaderOverflowCount() < 24; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      TEST_LOG_I(LOGGER_ID) << "overflow count: " << serial->getReaderOverflowCount();
+
+      ASSERT_EQ(24, serial->getReaderOverflowCount());
+      ASSERT_EQ(16, serial->getReaderHighWaterMark());
+
+      serial->stopReader();
+
+      ASSERT_FALSE(serial->isReaderRunning());
+      ASSERT_EQ(16, serial->readBytes(32).size());
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test4) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 500);
+      serial->startWriter(64, 256, 2000);
+
+      ASSERT_TRUE(serial->isWriterRunning());
+
+      std::string expected;
+      std::vector<std::future<size_t>> futures;
+      for (size_t i = 0; i < 200; i++) {
+        std::string data = "cmd" + std::to_string(i) + ";";
+        expected += data;
+        futures.emplace_back(serial->writeAsync(std::vector<unsigned char>(data.begin(), data.end())));
+      }
+
+      size_t length = 0;
+      for (std::future<size_t>& future : futures) {
+        length += future.get();
+      }
+      TEST_LOG_I(LOGGER_ID) << "sent length: " << length;
+
+      ASSERT_EQ(expected.size(), length);
+
+      std::vector<unsigned char> received = pty.read(expected.size(), 500);
+
+      ASSERT_EQ(expected, std::string(received.begin(), received.end()));
+
+      serial->stopWriter();
+
+      ASSERT_FALSE(serial->isWriterRunning());
+      ASSERT_THROW(serial->writeAsync({'x'}), std::runtime_error);
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test5) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>(true, true);
+      serial->open(pty.getSlavePath(), 100);
+      TEST_LOG_I(LOGGER_ID) << "io_uring enabled: " << serial->isIoUringEnabled();
+
+      ASSERT_EQ(IoUring::isSupported(), serial->isIoUringEnabled());
+
+      std::array<std::byte, 5> buffer = {};
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      size_t length = serial->readInto(buffer);
+      std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+      TEST_LOG_I(LOGGER_ID) << "timeout elapsed: " << elapsed.count() << "ms";
+
+      ASSERT_EQ(0, length);
+      ASSERT_GE(elapsed.count(), 90);
+
+      std::string data = "hello";
+      length = serial->writeFrom(std::as_bytes(std::span<const char>(data)));
+
+      ASSERT_EQ(5, length);
+      ASSERT_EQ(std::vector<unsigned char>(data.begin(), data.end()), pty.read(5, 500));
+
+      data = "HELLO";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+      length = serial->readInto(buffer);
+
+      ASSERT_EQ(5, length);
+      ASSERT_EQ(data, std::string(reinterpret_cast<const char*>(buffer.data()), length));
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test6) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 50);
+
+      std::string data = "line1\r\nline2\nabc,def,rest";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      ASSERT_EQ("line1\r\n", serial->readLine(64));
+      ASSERT_EQ("line2\n", serial->readLine(64));
+
+      std::span<const std::byte> view = serial->readUntil(std::byte(','), 64);
+
+      ASSERT_EQ("abc,", std::string(reinterpret_cast<const char*>(view.data()), view.size()));
+
+      view = serial->readUntil(std::byte(','), 2);
+
+      ASSERT_EQ("de", std::string(reinterpret_cast<const char*>(view.data()), view.size()));
+
+      std::string received;
+      std::array<std::byte, 3> buffer = {};
+      for (size_t length = serial->readInto(buffer); length > 0; length = serial->readInto(buffer)) {
+        received.append(reinterpret_cast<const char*>(buffer.data()), length);
+      }
+
+      ASSERT_EQ("f,rest", received);
+      ASSERT_TRUE(serial->readLine(64).empty());
+
+      data = std::string(1000, 'x') + "\n";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      ASSERT_EQ(data, serial->readLine());
+
+      serial->startReader(64);
+      data = "x\ny";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      ASSERT_EQ("x\n", serial->readLine(64));
+      ASSERT_TRUE(serial->readLine(64).empty());
+
+      data = "\n";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      ASSERT_EQ("y\n", serial->readLine(64));
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test7) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::vector<std::pair<std::string, std::string>> records;
+      PtyDevice pty;
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->setLogFunction([&records](
+          const std::string& file,
+          const size_t& line,
+          const std::string& function,
+          const std::string& id,
+          const unsigned short& level,
+          const std::string& message
+      ) {
+        records.emplace_back(file, message);
+      });
+      serial->setLogLevel(4);
+
+      ASSERT_EQ(4, serial->getLogLevel());
+
+      serial->open(pty.getSlavePath(), 50);
+      serial->close();
+
+      ASSERT_TRUE(records.empty());
+
+      serial->setLogLevel(5);
+      serial->open(pty.getSlavePath(), 50);
+      serial->close();
+
+#if !defined(NDEBUG)
+      ASSERT_EQ(1, records.size());
+      ASSERT_EQ("Serial.cpp", records.at(0).first);
+      ASSERT_EQ("port: '" + pty.getSlavePath() + "'", records.at(0).second);
+#endif
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test8) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::error_code error;
+      std::array<std::byte, 8> buffer = {};
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+
+      ASSERT_EQ(0, serial->readInto(buffer, error));
+      ASSERT_EQ(std::errc::not_connected, error);
+
+      serial->open("/dev/exqudens-serial-missing", 50, error);
+      TEST_LOG_I(LOGGER_ID) << "open error: '" << error.message() << "'";
+
+      ASSERT_TRUE(error);
+      ASSERT_FALSE(serial->isOpen());
+
+      std::exception_ptr exception = nullptr;
+      try {
+        serial->open("/dev/exqudens-serial-missing", 50);
+      } catch (const std::runtime_error&) {
+        exception = std::current_exception();
+      }
+
+      ASSERT_NE(nullptr, exception);
+
+      // The wrapped library failure stays nested under the call info.
+      while (true) {
+        try {
+          std::rethrow_exception(exception);
+        } catch (const std::nested_exception& e) {
+          exception = e.nested_ptr();
+          continue;
+        } catch (...) {
+          break;
+        }
+      }
+
+      ASSERT_THROW(std::rethrow_exception(exception), serial::IOException);
+      ASSERT_FALSE(serial->isOpen());
+
+      PtyDevice pty;
+      serial->open(pty.getSlavePath(), 50, error);
+
+      ASSERT_FALSE(error);
+
+      std::string data = "abc";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+
+      ASSERT_EQ(3, serial->readInto(buffer, error));
+      ASSERT_FALSE(error);
+      ASSERT_EQ(0, serial->readInto(buffer, error));
+      ASSERT_FALSE(error);
+      ASSERT_EQ(3, serial->writeFrom(std::as_bytes(std::span<const char>(data)), error));
+      ASSERT_FALSE(error);
+
+      serial->close(error);
+
+      ASSERT_FALSE(error);
+      ASSERT_EQ(0, serial->writeFrom(std::as_bytes(std::span<const char>(data)), error));
+      ASSERT_EQ(std::errc::not_connected, error);
+      ASSERT_THROW(serial->writeFrom(std::as_bytes(std::span<const char>(data))), std::runtime_error);
+
+      // Without auto close the destructor still releases every handle.
+      std::ptrdiff_t handles = std::distance(std::filesystem::directory_iterator("/proc/self/fd"), {});
+      {
+        Serial unmanaged(false);
+        unmanaged.open(pty.getSlavePath(), 50);
+      }
+
+      ASSERT_EQ(handles, std::distance(std::filesystem::directory_iterator("/proc/self/fd"), {}));
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test9) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+
+      ASSERT_THROW(serial->setBaudRate(115200), std::runtime_error);
+
+      PtyDevice pty;
+      serial->open(pty.getSlavePath(), 100);
+      int nativeHandle = serial->getNativeHandle();
+
+      std::string data = "before";
+      pty.write(std::vector<unsigned char>(data.begin(), data.end()));
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+      serial->setBaudRate(115200);
+      serial->setBaudRate(115200);
+      serial->setTimeouts(0, 200, 0, 200, 0);
+      serial->setFraming(8, 0, 0);
+      serial->setFraming(7, 2, 2);
+      serial->setFlowControl(0);
+
+      ASSERT_THROW(serial->setFraming(9, 0, 0), std::runtime_error);
+      ASSERT_THROW(serial->setFlowControl(3), std::runtime_error);
+      ASSERT_TRUE(serial->isOpen());
+      ASSERT_EQ(nativeHandle, serial->getNativeHandle());
+
+      std::vector<unsigned char> bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ(data, std::string(bytes.begin(), bytes.end()));
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      bytes = serial->readBytes(1);
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      TEST_LOG_I(LOGGER_ID) << "read timeout after reconfiguration: " << elapsed << "s";
+
+      ASSERT_TRUE(bytes.empty());
+      ASSERT_GE(elapsed, 0.15);
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test10) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      Serial::LowLatency profile = {.enabled = true, .busyPoll = std::chrono::microseconds(100), .cpu = 0, .priority = 0};
+
+      ASSERT_FALSE(serial->setLowLatency(profile));
+      ASSERT_THROW(serial->setLowLatency({.enabled = true, .priority = 1000}), std::runtime_error);
+
+      PtyDevice pty;
+      pty.startEcho();
+      serial->open(pty.getSlavePath(), 200);
+      TEST_LOG_I(LOGGER_ID) << "driver low latency: " << serial->setLowLatency(profile);
+
+      std::string data = "ping";
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      std::vector<unsigned char> bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ(data, std::string(bytes.begin(), bytes.end()));
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      bytes = serial->readBytes(1);
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      ASSERT_TRUE(bytes.empty());
+      ASSERT_GE(elapsed, 0.15);
+
+      serial->startReader(1024);
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ(data, std::string(bytes.begin(), bytes.end()));
+
+      serial->stopReader();
+      serial->setLowLatency({});
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ(data, std::string(bytes.begin(), bytes.end()));
+
+      serial->close();
+      pty.stop();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test11) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->setThreadSafe(true);
+
+      ASSERT_TRUE(serial->isThreadSafe());
+
+      PtyDevice pty;
+      pty.startEcho();
+      serial->open(pty.getSlavePath(), 1000);
+
+      std::vector<std::byte> expected(16384);
+      for (size_t i = 0; i < expected.size(); i++) {
+        expected.at(i) = std::byte(i % 251);
+      }
+      std::thread writer([&serial, &expected] {
+        for (size_t i = 0; i < expected.size(); i += 256) {
+          serial->writeFrom(std::span<const std::byte>(expected).subspan(i, 256));
+        }
+      });
+      std::vector<std::byte> received(expected.size());
+      size_t size = 0;
+      while (size < received.size()) {
+        size_t length = serial->readInto(std::span<std::byte>(received).subspan(size));
+        if (length == 0) {
+          break;
+        }
+        size += length;
+      }
+      writer.join();
+
+      ASSERT_EQ(expected, received);
+
+      pty.stop();
+      serial->setTimeouts(serial::Timeout::max(), 5000, 0, 1000, 0);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      std::future<std::vector<unsigned char>> blocked = std::async(std::launch::async, [&serial] {
+        return serial->readBytes(1);
+      });
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      std::thread closer([&serial] {
+        serial->close();
+      });
+      serial->close();
+      closer.join();
+
+      ASSERT_THROW(blocked.get(), std::runtime_error);
+      ASSERT_LT(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), 1.0);
+      ASSERT_FALSE(serial->isOpen());
+      ASSERT_THROW(serial->readBytes(1), std::runtime_error);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(SerialUnitTests, test12) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      // 'close' writes the messages still queued for the writer before the port is closed.
+      for (bool threadSafe : {false, true}) {
+        PtyDevice pty;
+        std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+        serial->setThreadSafe(threadSafe);
+        serial->open(pty.getSlavePath(), 200);
+        serial->startWriter(16, 4096, 200000);
+        std::future<size_t> future = serial->writeAsync({'a', 'b', 'c'});
+        serial->close();
+
+        ASSERT_EQ(3, future.get());
+        std::vector<unsigned char> received = pty.read(3, 200);
+        ASSERT_EQ(std::string("abc"), std::string(received.begin(), received.end()));
+        ASSERT_FALSE(serial->isWriterRunning());
+      }
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+#endif
+
 }
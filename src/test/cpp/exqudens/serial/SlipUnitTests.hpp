@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/Slip.hpp"
+
+namespace exqudens {
+
+  class SlipUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.SlipUnitTests";
+
+      static std::vector<std::byte> toBytes(const std::vector<unsigned int>& values) {
+        std::vector<std::byte> result;
+        for (unsigned int value : values) {
+          result.emplace_back(static_cast<std::byte>(value));
+        }
+        return result;
+      }
+
+      static std::vector<std::byte> encode(std::vector<std::byte> bytes) {
+        size_t size = bytes.size();
+        bytes.resize(Slip::getEncodedSize(bytes));
+        bytes.resize(Slip::encode(bytes, size));
+        return bytes;
+      }
+
+  };
+
+  TEST_F(SlipUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      ASSERT_EQ(toBytes({0xC0, 0xC0}), encode({}));
+      ASSERT_EQ(toBytes({0xC0, 0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0xC0}), encode(toBytes({0x01, 0xC0, 0x02, 0xDB})));
+      ASSERT_EQ(toBytes({0xC0, 0xDB, 0xDC, 0xDB, 0xDC, 0xC0}), encode(toBytes({0xC0, 0xC0})));
+
+      std::mt19937 random(13);
+      for (size_t size : {1, 2, 15, 16, 17, 33, 100, 4096}) {
+        for (unsigned int escapeRate : {1, 8, 1000}) {
+          std::vector<std::byte> payload(size);
+          for (std::byte& value : payload) {
+            value = random() % escapeRate == 0 ? (random() % 2 == 0 ? Slip::END : Slip::ESC) : static_cast<std::byte>(random() % 0xC0);
+          }
+          std::vector<std::byte> buffer = encode(payload);
+
+          ASSERT_LE(buffer.size(), Slip::getMaxEncodedSize(size));
+          ASSERT_EQ(Slip::END, buffer.front());
+          ASSERT_EQ(Slip::END, buffer.back());
+          ASSERT_EQ(buffer.end() - 1, std::find(buffer.begin() + 1, buffer.end(), Slip::END));
+
+          std::vector<std::byte> frame(buffer.begin() + 1, buffer.end() - 1);
+          frame.resize(Slip::decode(frame));
+
+          ASSERT_EQ(payload, frame);
+        }
+      }
+
+      std::vector<std::byte> small(2);
+      small.at(0) = Slip::ESC;
+
+      ASSERT_THROW(Slip::encode(small, 1), std::runtime_error);
+
+      std::vector<std::byte> malformed = toBytes({0x01, 0xDB, 0x02});
+
+      ASSERT_THROW(Slip::decode(malformed), std::runtime_error);
+
+      malformed = toBytes({0x01, 0xDB});
+
+      ASSERT_THROW(Slip::decode(malformed), std::runtime_error);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
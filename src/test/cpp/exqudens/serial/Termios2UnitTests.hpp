@@ -0,0 +1,99 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/Termios2.hpp"
+
+namespace exqudens {
+
+  class Termios2UnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.Termios2UnitTests";
+
+  };
+
+  TEST_F(Termios2UnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      ASSERT_TRUE(Termios2::isStandardBaudRate(115200));
+      ASSERT_TRUE(Termios2::isStandardBaudRate(3000000));
+      ASSERT_FALSE(Termios2::isStandardBaudRate(250000));
+      ASSERT_FALSE(Termios2::isStandardBaudRate(12000000));
+
+      PtyDevice pty;
+      int handle = ::open(pty.getSlavePath().c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC);
+
+      ASSERT_GE(handle, 0);
+      ASSERT_EQ(12000000, Termios2::setBaudRate(handle, 12000000));
+      ASSERT_EQ(12000000, Termios2::getBaudRate(handle));
+      ASSERT_EQ(std::vector<unsigned int>({250000, 2000000, 0}), Termios2::getAchievableBaudRates(handle, {250000, 2000000, 0}));
+      ASSERT_EQ(12000000, Termios2::getBaudRate(handle));
+      ASSERT_THROW(Termios2::setBaudRate(handle, 0), std::runtime_error);
+      ASSERT_THROW(Termios2::getBaudRate(-1), std::runtime_error);
+
+      ::close(handle);
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(Termios2UnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      pty.startEcho();
+      std::shared_ptr<ISerial> serial = std::make_shared<Serial>();
+      serial->open(pty.getSlavePath(), 12000000, 0, 200, 0, 200, 0, 8, 0, 0, 0);
+
+      ASSERT_EQ(12000000, serial->getBaudRate());
+
+      std::string data = "fast";
+      serial->writeBytes(std::vector<unsigned char>(data.begin(), data.end()));
+      std::vector<unsigned char> bytes = serial->readBytes(data.size());
+
+      ASSERT_EQ(data, std::string(bytes.begin(), bytes.end()));
+
+      serial->setFraming(7, 0, 0);
+
+      ASSERT_EQ(12000000, serial->getBaudRate());
+      ASSERT_EQ(3000000, serial->setBaudRate(3000000));
+      ASSERT_EQ(250000, serial->setBaudRate(250000));
+      ASSERT_EQ(std::vector<unsigned int>({12000000, 9600}), serial->getAchievableBaudRates({12000000, 9600}));
+      ASSERT_EQ(250000, serial->getBaudRate());
+      ASSERT_EQ(115200, serial->setBaudRate(115200));
+
+      serial->close();
+      pty.stop();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
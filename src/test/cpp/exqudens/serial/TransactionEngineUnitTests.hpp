@@ -0,0 +1,150 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TestLogging.hpp"
+#include "TestUtils.hpp"
+#include "exqudens/serial/PtyDevice.hpp"
+#include "exqudens/serial/Serial.hpp"
+#include "exqudens/serial/TransactionEngine.hpp"
+
+namespace exqudens {
+
+  class TransactionEngineUnitTests : public testing::Test {
+
+    protected:
+
+      inline static const char* LOGGER_ID = "exqudens.TransactionEngineUnitTests";
+
+      // Frame: sequence id, payload size, payload.
+      static TransactionEngine::Key key(std::span<const std::byte> frame) {
+        return static_cast<TransactionEngine::Key>(frame[0]);
+      }
+
+      static size_t length(std::span<const std::byte> head) {
+        return head.size() < 2 ? 2 : 2 + static_cast<size_t>(head[1]);
+      }
+
+      static std::vector<std::byte> frame(const unsigned char& id, const std::string& payload) {
+        std::vector<std::byte> result = {std::byte(id), std::byte(payload.size())};
+        for (char c : payload) {
+          result.emplace_back(std::byte(c));
+        }
+        return result;
+      }
+
+      static std::errc errorOf(std::future<std::vector<std::byte>> future) {
+        try {
+          future.get();
+        } catch (const std::system_error& e) {
+          return static_cast<std::errc>(e.code().value());
+        }
+        return std::errc();
+      }
+
+  };
+
+  TEST_F(TransactionEngineUnitTests, test1) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      pty.startDelayedEcho(std::chrono::milliseconds(20));
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->setThreadSafe(true);
+      serial->open(pty.getSlavePath(), 50);
+
+      TransactionEngine engine(serial, key, length, 4);
+      std::vector<std::future<std::vector<std::byte>>> futures;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (unsigned char i = 0; i < 8; i++) {
+        futures.emplace_back(engine.submit(frame(i, "request-" + std::to_string(i)), std::chrono::milliseconds(1000)));
+      }
+      for (unsigned char i = 0; i < 8; i++) {
+        ASSERT_EQ(frame(i, "request-" + std::to_string(i)), futures.at(i).get());
+      }
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      TEST_LOG_I(LOGGER_ID) << "8 transactions of 20ms with depth 4 in " << elapsed << "s";
+
+      ASSERT_LT(elapsed, 0.12);
+      ASSERT_EQ(0, engine.getInFlightCount());
+      ASSERT_EQ(0, engine.getUnmatchedCount());
+
+      engine.stop();
+      serial->close();
+      pty.stop();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(TransactionEngineUnitTests, test2) {
+    try {
+      std::string testGroup = testing::UnitTest::GetInstance()->current_test_info()->test_suite_name();
+      std::string testCase = testing::UnitTest::GetInstance()->current_test_info()->name();
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' start";
+
+      PtyDevice pty;
+      std::shared_ptr<Serial> serial = std::make_shared<Serial>();
+      serial->setThreadSafe(true);
+      serial->open(pty.getSlavePath(), 20);
+
+      TransactionEngine engine(serial, key, length, 4);
+      std::future<std::vector<std::byte>> first = engine.submit(frame(1, "a"), std::chrono::milliseconds(1000));
+      std::future<std::vector<std::byte>> second = engine.submit(frame(2, "bb"), std::chrono::milliseconds(1000));
+      std::future<std::vector<std::byte>> third = engine.submit(frame(3, "ccc"), std::chrono::milliseconds(1000));
+
+      ASSERT_THROW(engine.submit(frame(2, "again"), std::chrono::milliseconds(1000)), std::runtime_error);
+      ASSERT_EQ(3, engine.getInFlightCount());
+      ASSERT_EQ(12, pty.read(12, 200).size());
+
+      pty.write({3, 1, 'z', 9, 0, 2, 1, 'y', 1, 1, 'x'});
+
+      ASSERT_EQ(frame(1, "x"), first.get());
+      ASSERT_EQ(frame(2, "y"), second.get());
+      ASSERT_EQ(frame(3, "z"), third.get());
+      ASSERT_EQ(1, engine.getUnmatchedCount());
+
+      std::future<std::vector<std::byte>> late = engine.submit(frame(4, "d"), std::chrono::milliseconds(50));
+      std::future<std::vector<std::byte>> canceled = engine.submit(frame(5, "e"), std::chrono::milliseconds(10000));
+
+      ASSERT_EQ(std::errc::timed_out, errorOf(std::move(late)));
+      ASSERT_EQ(1, engine.getInFlightCount());
+
+      pty.write({4, 0});
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+      ASSERT_EQ(2, engine.getUnmatchedCount());
+
+      engine.stop();
+
+      ASSERT_EQ(std::errc::operation_canceled, errorOf(std::move(canceled)));
+      ASSERT_EQ(std::errc::operation_canceled, errorOf(engine.submit(frame(6, "f"), std::chrono::milliseconds(10))));
+
+      serial->close();
+
+      TEST_LOG_I(LOGGER_ID) << "'" << testGroup << "." << testCase << "' end";
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
+
+#endif
@@ -15,6 +15,7 @@ class ConanConfiguration(ConanFile):
         try:
             self.requires("easyloggingpp/9.89")
             self.requires("gtest/1.11.0")
+            self.requires("benchmark/1.7.1")
         except Exception as e:
             logging.error(e, exc_info=True)
             raise e
@@ -23,6 +24,7 @@ class ConanConfiguration(ConanFile):
         try:
             self.options["easyloggingpp"].interface = True
             self.options["gtest"].shared = self.options.shared
+            self.options["benchmark"].shared = self.options.shared
         except Exception as e:
             logging.error(e, exc_info=True)
             raise e